@@ -79,8 +79,8 @@ PathView {
     delegate: SpinnerDelegate { }
 
     path: Path {
-        startX: pv.width/2; startY: pv.height/2-pv.model*Dims.h(6)
-        PathLine { x: pv.width/2; y: pv.height/2+pv.model*Dims.h(6) }
+        startX: pv.width/2; startY: pv.height/2-pv.model*Dims.heightUnit * 6
+        PathLine { x: pv.width/2; y: pv.height/2+pv.model*Dims.heightUnit * 6 }
     }
 
     Rectangle {
@@ -20,8 +20,7 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 import QtQuick
-import QtQuick.Window
-import org.asteroid.utils
+import org.asteroid.controls
 
 pragma Singleton
 
@@ -35,7 +34,8 @@ pragma Singleton
     screen proportions. Use the Dims::w function wherever you need to specify a size relative to
     the screen width, and Dims::h when you need a dimension relative to the height. Dims::l
     provides a ratio of the smallest dimension for smartwatches that could have a screen larger than
-    high.
+    high. The same ratios are available as the widthUnit, heightUnit and lengthUnit properties,
+    each one percent of the matching dimension.
 
     Here is a short example:
 
@@ -45,7 +45,7 @@ pragma Singleton
 
     Rectangle {
         width: Dims.w(80) // 80 % of screen width
-        height: Dims.h(50) // 50 % of screen height
+        height: Dims.heightUnit * 50 // 50 % of screen height
 
         Label {
             text:"A"
@@ -53,16 +53,46 @@ pragma Singleton
         }
     }
     \endqml
+
+    Screen metrics are read once and only updated when the screen changes,
+    bindings using either the functions or the units follow those changes.
 */
 QtObject {
-    id: units
+    /*!
+        \brief The available screen width.
+    */
+    readonly property real screenWidth: Dims_p.screenWidth
+    /*!
+        \brief The available screen height, including the flat tire area.
+    */
+    readonly property real screenHeight: Dims_p.screenHeight
+    /*!
+        \brief One percent of the screen width.
+    */
+    readonly property real widthUnit: Dims_p.widthUnit
+    /*!
+        \brief One percent of the screen height.
+    */
+    readonly property real heightUnit: Dims_p.heightUnit
+    /*!
+        \brief One percent of the screen width or height; whichever is smaller.
+    */
+    readonly property real lengthUnit: Dims_p.lengthUnit
+    /*!
+        \brief The default icon button margin used.
+    */
+    readonly property real iconButtonMargin: Dims_p.iconButtonMargin
+    /*!
+        \brief The default font size used.
+    */
+    readonly property real defaultFontSize: Dims_p.defaultFontSize
 
     /*!
         \qmlmethod real w(real number)
         \brief Returns a dimension that is \a number percent of the screen width.
     */
     function w(number: real): real {
-        return (number/100)*Screen.desktopAvailableWidth
+        return number*widthUnit
     }
 
     /*!
@@ -70,7 +100,7 @@ QtObject {
         \brief Returns a dimension that is \a number percent of the screen height.
     */
     function h(number: real): real {
-        return (number/100)*(Screen.desktopAvailableHeight+DeviceSpecs.flatTireHeight)
+        return number*heightUnit
     }
 
     /*!
@@ -78,18 +108,6 @@ QtObject {
         \brief Returns a dimension that is \a number percent of the screen width or height; whichever is smaller.
     */
     function l(number: real): real {
-        if(Screen.desktopAvailableWidth > (Screen.desktopAvailableHeight+DeviceSpecs.flatTireHeight))
-            return h(number)
-        else
-            return w(number)
+        return number*lengthUnit
     }
-
-    /*!
-        \brief The default icon button margin used.
-    */
-    property real iconButtonMargin: l(3)
-    /*!
-        \brief The default font size used.
-    */
-    property real defaultFontSize:  l(7)
 }
@@ -63,7 +63,7 @@ MouseArea {
     /*! The name of the icon */
     property alias iconName: icon.name
 
-    width: Dims.l(20)
+    width: Dims.lengthUnit * 20
     height: width
 
     Icon {
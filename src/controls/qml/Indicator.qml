@@ -111,8 +111,8 @@ Item {
         else                         return 135
     }
 
-    property real finWidth: Dims.l(1.5)
-    property real bodyWidthLow: Dims.l(1.8)
+    property real finWidth: Dims.lengthUnit * 1.5
+    property real bodyWidthLow: Dims.lengthUnit * 1.8
     property real bodyWidthHigh: 2*finWidth
     property real bodyOpacityLow: 0.6
     property real bodyOpacityHigh: 0.8
@@ -127,7 +127,7 @@ Item {
             bodyOpacityLow = bodyOpacityHigh
             offsetLow = offsetHigh
         } else {
-            bodyWidthLow = Dims.l(1.8)
+            bodyWidthLow = Dims.lengthUnit * 1.8
             bodyOpacityLow = 0.6
             offsetLow = 0
         }
@@ -115,12 +115,12 @@ ListRow {
         id: track
         anchors {
             left: parent.left
-            leftMargin: Dims.l(1.8)
+            leftMargin: Dims.lengthUnit * 1.8
             right: parent.right
-            rightMargin: rowMargin + Dims.l(1.8)
+            rightMargin: rowMargin + Dims.lengthUnit * 1.8
             verticalCenter: parent.verticalCenter
         }
-        height: iconSize - Dims.l(3.6)
+        height: iconSize - Dims.lengthUnit * 3.6
         radius: height / 2
         color: Qt.rgba(0, 0, 0, 0)
 
@@ -161,7 +161,7 @@ ListRow {
             radius: parent.radius
             border {
                 color: Qt.rgba(1, 1, 1, 1.0)
-                width: Dims.l(0.64)
+                width: Dims.lengthUnit * 0.64
             }
         }
 
@@ -170,7 +170,7 @@ ListRow {
             iconName: "ios-remove"
             anchors {
                 left: parent.left
-                leftMargin: -Dims.l(1.5)
+                leftMargin: -Dims.lengthUnit * 1.5
                 verticalCenter: parent.verticalCenter
             }
             width: iconSize
@@ -184,7 +184,7 @@ ListRow {
             iconName: "ios-add"
             anchors {
                 right: parent.right
-                rightMargin: -Dims.l(1.5)
+                rightMargin: -Dims.lengthUnit * 1.5
                 verticalCenter: parent.verticalCenter
             }
             width: iconSize
@@ -216,7 +216,7 @@ ListRow {
             property int startX: 0
             property int startY: 0
             property bool tracking: false
-            property int threshold: Dims.l(2)
+            property int threshold: Dims.lengthUnit * 2
 
             onPressed: {
                 startX = mouseX
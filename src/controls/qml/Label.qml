@@ -38,8 +38,8 @@ import org.asteroid.controls
         color: "yellow"
         Rectangle {
             anchors.centerIn: parent
-            width: Dims.w(50)
-            height: Dims.h(10)
+            width: Dims.widthUnit * 50
+            height: Dims.heightUnit * 10
             color: "blue"
 
             Label {
@@ -45,8 +45,8 @@ import org.asteroid.controls
         LabeledSwitch {
             anchors.top: square.bottom
             anchors.horizontalCenter: square.horizontalCenter
-            width: Dims.l(80)
-            height: Dims.l(20)
+            width: Dims.lengthUnit * 80
+            height: Dims.lengthUnit * 20
             text: "Enable"
             checked: false
             onCheckedChanged: {
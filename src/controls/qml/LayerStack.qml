@@ -28,6 +28,16 @@ import QtQuick
     This provides a way to manage a virtual stack of QML compoments
     and to navigate between them.
 
+    Pages can be built without blocking the GUI thread by setting
+    \l asynchronous, pages that are likely to be opened next can be
+    created ahead of time with preload(), and \l cacheSize keeps recently
+    popped pages alive so that going back and forth does not rebuild them.
+
+    Only the current page is rendered, pages deeper in the stack are hidden
+    until they are revealed again. Transitions only move the pages and run
+    on the render thread. Once the stack reaches \l trimDepth, cached and
+    preloaded pages are dropped to save memory.
+
     Because \l LayerStack is a more advanced and complex control, the
     example program is longer than usual, but not too complex.  There 
     are three different \l Component elements defined, named "top", "one",
@@ -88,29 +98,57 @@ Item {
     objectName: "LayerStack"
 
     /*! The top level page of the stack */
-    property var firstPage
+    property alias firstPage: stack.firstPage
     /*! The collection of pages of the stack */
-    property var layers: []
+    property alias layers: stack.layers
     /*! The current layer of the stack */
-    property var currentLayer: layers.length > 0 ? layers[layers.length-1] : null
-    property var firstPageItem
+    property alias currentLayer: stack.currentLayer
+    property alias firstPageItem: stack.firstPageItem
     /*! Can be set to null if you don't want indicators animations and systemgestures override. If your LayerStack isn't directly a child element of your window, you can also specify the window via this parameter. */
     property QtObject win: parent  
+    /*! Create layers incrementally without blocking the GUI thread. When set, push() returns null and the layer is shown once it is ready. */
+    property alias asynchronous: stack.asynchronous
+    /*! Number of popped layers kept alive and reused by later pushes of the same component. */
+    property alias cacheSize: stack.cacheSize
+    /*! Depth at which cached and preloaded layers are released. Set to 0 to never release them. */
+    property alias trimDepth: stack.trimDepth
+
+    LayerStack_p {
+        id: stack
+        width: layersStack.width
+        height: layersStack.height
+        transitioning: pushAnim.running || popAnimation.running || cancelAnimation.running || gestureArea.state === "swipe"
+
+        onLayerPushed: {
+            pushAnim.stop()
+            pushAnimX.from = -(depth-1)*layersStack.width
+            pushAnimX.to = -depth*layersStack.width
+            pushAnim.start()
+        }
 
-    Flickable {
-        id: contentArea
-        anchors.fill: parent
-        interactive: false
-        Row { id: content }
+        onLayerPopped: {
+            x = -depth*layersStack.width
+            if(win !== null)
+                win.animIndicators()
+        }
+
+        onLayersChanged: {
+            if(win !== null)
+                win.setOverridesSystemGestures(depth > 0)
+        }
+    }
+
+    onWidthChanged: {
+        if (!pushAnim.running)
+            stack.x = -stack.depth*width
     }
 
     SequentialAnimation {
         id: pushAnim
 
-        NumberAnimation {
+        XAnimator {
             id: pushAnimX
-            target: contentArea
-            property: "contentX"
+            target: stack
             duration: 200
             easing.type: Easing.OutQuint
         }
@@ -118,91 +156,100 @@ Item {
         ScriptAction { script: if(win !== null) win.animIndicators() }
     }
 
-    onFirstPageChanged: {
-        if(typeof firstPage != 'undefined') {
-            if (firstPageItem) {
-                firstPageItem.destroy()
-            }
-            while (layers.length > 0) {
-                pop(currentLayer)
-            }
-            var params = {}
-            params["width"] = Qt.binding(function() { return width })
-            params["height"] =  Qt.binding(function() { return height })
-            params["x"] = 0
-            params["y"] = 0
-            if(typeof firstPage != 'undefined' && firstPage.status === Component.Ready) {
-                firstPageItem=firstPage.createObject(content, params)
-                firstPageItem.clip = true
-                layersChanged()
-            }
-        } else {
-            console.log("LayerStack: firstpage has been updated with a null value")
-        }
-    }
+    /*!
+        \qmlmethod var push(Component component, var params)
+        \brief Creates an instance of \a component with the given \a params and pushes it on top of the
+        stack. Recently popped or preloaded instances of the same component are reused when
+        available; their properties are then updated from \a params.
 
+        Returns the new layer, or null if it is still being created asynchronously.
+    */
     function push(component, params) {
-        if (component.status === Component.Ready) {
-            if (typeof params === 'undefined') params = {}
-            params["width"] = Qt.binding(function() { return width })
-            params["height"] =  Qt.binding(function() { return height })
-            params["depth"] = (layers.length+1)
-            params["x"] = params["depth"]*width
-            params["y"] = 0
-            params["clip"] = true
-
-            var layer;
-            params["pop"] = function() { layersStack.popAnim(); }
-            layer = component.createObject(content, params);
-            layers.push(layer);
-            pushAnimX.to = layers.length*width
-            pushAnim.start();
-            if(win !== null)
-                win.setOverridesSystemGestures(layers.length > 0)
-            layersChanged();
-            return layer   
-        }
+        if (typeof params === 'undefined') params = {}
+        params["pop"] = function() { layersStack.popAnim(); }
+        return stack.push(component, params)
+    }
+
+    /*!
+        \qmlmethod preload(Component component, var params)
+        \brief Starts creating an instance of \a component with the given \a params in the background,
+        so that a later push() of the same component shows it instantly.
+    */
+    function preload(component, params) {
+        if (typeof params === 'undefined') params = {}
+        params["pop"] = function() { layersStack.popAnim(); }
+        stack.preload(component, params)
+    }
+
+    /*!
+        \qmlmethod clearCache()
+        \brief Destroys all the preloaded and cached layers.
+    */
+    function clearCache() {
+        stack.clearCache()
     }
 
     function popAnim() {
-        swipeAnimation.valueTo = width
-        swipeAnimation.start();
+        popAnimation.start()
     }
 
     function pop(layer) {
-        layer.destroy();
-        layers.pop(layer);
-        contentArea.contentX = layers.length*width
-        if(win !== null)
-            win.setOverridesSystemGestures(layers.length > 0)
-        layersChanged();
-        if(win !== null)
-            win.animIndicators()
+        stack.pop(layer)
+    }
+
+    SequentialAnimation {
+        id: popAnimation
+
+        XAnimator {
+            target: stack
+            to: -(stack.depth-1)*layersStack.width
+            duration: 200
+            easing.type: Easing.OutQuint
+        }
+
+        ScriptAction { script: pop(currentLayer) }
+    }
+
+    SequentialAnimation {
+        id: cancelAnimation
+
+        XAnimator {
+            target: stack
+            to: -stack.depth*layersStack.width
+            duration: 200
+            easing.type: Easing.OutQuint
+        }
+
+        ScriptAction { script: if(win !== null) win.animIndicators() }
     }
 
     BorderGestureArea {
         id: gestureArea
         anchors.fill: parent
-        enabled: layers.length > 0
+        enabled: stack.depth > 0
         acceptsRight: true
 
         property real swipeThreshold: 0.15
+        // Releases faster than a screen width per second pop regardless of distance.
+        property real flingVelocity: layersStack.width
 
-        onGestureStarted: (gesture) => {
-            swipeAnimation.stop()
+        onGestureStarted: {
+            popAnimation.stop()
             cancelAnimation.stop()
-            if (gesture == "right")
+            if (gestureType === BorderGestureArea.Right)
                 state = "swipe"
         }
 
-        onGestureFinished: (gesture) => {
-            if (gesture == "right") {
-                if (gestureArea.progress >= swipeThreshold) {
-                    swipeAnimation.valueTo = width
-                    swipeAnimation.start()
-                } else
-                    cancelAnimation.start()
-            } else
+        onGestureFinished: {
+            // Hand the finger position over to the animators.
+            var currentX = stack.x
+            state = ""
+            stack.x = currentX
+
+            if (gestureType === BorderGestureArea.Right &&
+                    (progress >= swipeThreshold || velocity >= flingVelocity))
+                popAnimation.start()
+            else
                 cancelAnimation.start()
         }
 
@@ -211,63 +258,10 @@ Item {
                 name: "swipe"
 
                 PropertyChanges {
-                    target: gestureArea
-                    delayReset: true
-                }
-
-                PropertyChanges {
-                    target: contentArea
-                    contentX: layers.length*width - gestureArea.value
+                    target: stack
+                    x: -stack.depth*layersStack.width + gestureArea.value
                 }
             }
         ]
-
-        SequentialAnimation {
-            id: cancelAnimation
-
-            NumberAnimation {
-                target: gestureArea
-                property: "value"
-                to: 0
-                duration: 200
-                easing.type: Easing.OutQuint
-            }
-
-            PropertyAction {
-                target: gestureArea
-                property: "state"
-                value: ""
-            }
-
-            ScriptAction { script: if(win !== null) win.animIndicators() }
-        }
-
-        SequentialAnimation {
-            id: swipeAnimation
-
-            property alias valueTo: valueAnimation.to
-
-            PropertyAction {
-                target: gestureArea
-                property: "state"
-                value: "swipe"
-            }
-
-            NumberAnimation {
-                id: valueAnimation
-                target: gestureArea
-                property: "value"
-                duration: 200
-                easing.type: Easing.OutQuint
-            }
-
-            PropertyAction {
-                target: gestureArea
-                property: "state"
-                value: ""
-            }
-
-            ScriptAction { script: pop(currentLayer) }
-        }
     }
 }
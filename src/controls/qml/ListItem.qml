@@ -72,14 +72,14 @@ Item {
     /*! alias to recieve boolean highlight.forceOn */
     property alias highlight: highlight.forceOn
     /*! size of the icon/s */
-    property int iconSize: height - Dims.h(6)
+    property int iconSize: height - Dims.heightUnit * 6
     /*! size of the label text */
-    property int labelFontSize: Dims.l(9)
+    property int labelFontSize: Dims.lengthUnit * 9
     /*! forward the clicked() signal to parent */
     signal clicked()
 
     width: parent.width
-    height: Dims.h(21)
+    height: Dims.heightUnit * 21
 
     HighlightBar {
         id: highlight
@@ -96,7 +96,7 @@ Item {
         anchors {
             verticalCenter: parent.verticalCenter
             left: parent.left
-            leftMargin: DeviceSpecs.hasRoundScreen ? Dims.w(18) : Dims.w(12)
+            leftMargin: DeviceSpecs.hasRoundScreen ? Dims.widthUnit * 18 : Dims.widthUnit * 12
         }
     }
 
@@ -104,7 +104,7 @@ Item {
         id: label
 
         anchors {
-            leftMargin: DeviceSpecs.hasRoundScreen ? Dims.w(6) : Dims.w(10)
+            leftMargin: DeviceSpecs.hasRoundScreen ? Dims.widthUnit * 6 : Dims.widthUnit * 10
             left: icon.right
             verticalCenter: parent.verticalCenter
         }
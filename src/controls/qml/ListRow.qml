@@ -45,7 +45,7 @@ import org.asteroid.controls
 
     ListRow {
         width: parent.width
-        height: Dims.l(15)
+        height: Dims.lengthUnit * 15
 
         Label {
             anchors {
@@ -104,16 +104,16 @@ Item {
     property alias text: labelContainer.text
 
     /*! Padding on each side of the action icon within the action slot, too enable placement of items wider than \l iconSize */
-    property int actionSlotPadding: Dims.l(6)
+    property int actionSlotPadding: Dims.lengthUnit * 6
 
     /*! Left and right margin for the row content */
-    property int rowMargin: Dims.w(15)
+    property int rowMargin: Dims.widthUnit * 15
 
     /*! Size of the right-side action widget */
-    property int iconSize: Dims.l(20)
+    property int iconSize: Dims.lengthUnit * 20
 
     /*! Base font size for label text */
-    property int labelFontSize: Dims.l(6)
+    property int labelFontSize: Dims.lengthUnit * 6
 
     /*! Default width is parent width */
     width: parent.width
@@ -32,8 +32,12 @@ import org.asteroid.controls
 
     Scrolling only runs when the text is wider than the available width.
     When text fits no animation runs. The \l paused property allows
-    callers to suppress scrolling entirely, for example when the
-    containing page is not visible.
+    callers to suppress scrolling entirely. Scrolling also stops on its
+    own while the marquee is not visible.
+
+    The text is laid out and rasterized once whenever it changes, and
+    scrolling only moves the cached result, so many marquees can run
+    at the same time without re-laying out any text.
 
     Here is a short example:
 
@@ -56,87 +60,69 @@ Item {
     clip: true
 
     /*! the text to display */
-    property alias text: animatedText.text
+    property alias text: scroller.text
     /*! the text \l Font */
-    property alias font: animatedText.font
+    property alias font: scroller.font
     /*! the text color */
-    property alias color: animatedText.color
+    property alias color: scroller.color
+    /*! how the text is interpreted, one of the Text.TextFormat values, Text.AutoText by default */
+    property alias textFormat: scroller.textFormat
     /*! suspend scrolling, e.g. when the containing page is not visible */
     property bool paused: false
     /*! relative speed for forward or backward motion */
     property real speed: 1.0
 
-    function originX() {
-        var ret = container.width-animatedText.width
-        if(ret > 0) return ret/2
-        else        return 0
-    }
+    // Internal
+    readonly property real _overflow: scroller.contentWidth - width
+    readonly property int _scrollDuration: 1000 * scroller.contentWidth / (speed * (width > 0 ? width : 1))
 
-    function destinationX() {
-        var ret = container.width-animatedText.width
-        if(ret < 0) return ret
-        else        return originX()
+    function _restartAnimation() {
+        scroller.x = 0
+        if (animation.running)
+            animation.restart()
     }
 
-    function restartAnimation() {
-        animation.start()
-        animation.stop()
-        if(paused || animatedText.width <= container.width) return
-            var scrollDuration = 1000 * animatedText.width / (speed * (container.width > 0 ? container.width : 1))
-            animHold.from = originX()
-            animHold.to = originX()
-            animForward.to = destinationX()
-            animForward.duration = scrollDuration
-            animHoldEnd.from = destinationX()
-            animHoldEnd.to = destinationX()
-            animBack.to = originX()
-            animBack.duration = scrollDuration
-            animation.start()
-    }
+    on_OverflowChanged: _restartAnimation()
+    on_ScrollDurationChanged: _restartAnimation()
+    implicitHeight: scroller.contentHeight
 
-    onWidthChanged: restartAnimation()
-    onPausedChanged: restartAnimation()
-    onSpeedChanged: restartAnimation()
-    implicitHeight: animatedText.contentHeight
-
-    Label {
-        id: animatedText
-        y: Math.round((container.height - contentHeight) / 2)
-        width: contentWidth
-        onWidthChanged: restartAnimation()
-        onTextChanged: restartAnimation()
-        elide: Text.ElideNone
+    Item {
+        id: track
+        x: container._overflow > 0 ? 0 : Math.round(-container._overflow / 2)
+        y: Math.round((container.height - scroller.contentHeight) / 2)
+
+        Marquee_p {
+            id: scroller
+            color: "white"
+            font.pixelSize: Dims.defaultFontSize
+        }
     }
 
+    // Animators only touch the transform of the cached text and run on the
+    // render thread, the GUI thread is not involved while scrolling.
     SequentialAnimation {
         id: animation
         loops: Animation.Infinite
+        running: container.visible && !container.paused && container._overflow > 0
+        onRunningChanged: if (!running) scroller.x = 0
 
-        NumberAnimation {
-            id: animHold
-            target: animatedText
-            property: "x"
-            duration: 2000
-        }
+        PauseAnimation { duration: 2000 }
 
-        NumberAnimation {
-            id: animForward
-            target: animatedText
-            property: "x"
+        XAnimator {
+            target: scroller
+            from: 0
+            to: -container._overflow
+            duration: container._scrollDuration
             easing.type: Easing.InOutQuad
         }
 
-        NumberAnimation {
-            id: animHoldEnd
-            target: animatedText
-            property: "x"
-            duration: 400
-        }
+        PauseAnimation { duration: 400 }
 
-        NumberAnimation {
-            id: animBack
-            target: animatedText
-            property: "x"
+        XAnimator {
+            target: scroller
+            from: -container._overflow
+            to: 0
+            duration: container._scrollDuration
             easing.type: Easing.InOutQuad
         }
     }
@@ -37,7 +37,7 @@ import org.asteroid.controls
 
         OptionCycler {
             width: parent.width
-            height: Dims.l(20)
+            height: Dims.lengthUnit * 20
             text: "Tap to cycle designs"
             valueArray: designOptions
             currentValue: designOptions[0]
@@ -72,7 +72,7 @@ ListRow {
         Size of the value label text. One step larger than \l labelFontSize to
         distinguish the operator value from the informational description.
     */
-    property int valueFontSize: Dims.l(7)
+    property int valueFontSize: Dims.lengthUnit * 7
 
     onClicked: {
         var currentIndex = valueArray.indexOf(currentValue)
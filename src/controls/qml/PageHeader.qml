@@ -53,7 +53,7 @@ Item {
     /*! The text to display. */
     property alias text: title.text
 
-    height: Dims.h(20)
+    height: Dims.heightUnit * 20
     anchors {
         top: parent.top
         left: parent.left
@@ -72,16 +72,16 @@ Item {
     Label {
         id: title
 
-        height: Dims.h(20)
+        height: Dims.heightUnit * 20
         anchors.centerIn: parent
         font {
             styleName: "SemiCondensed Light"
-            pixelSize: Dims.l(7)
+            pixelSize: Dims.lengthUnit * 7
         }
         verticalAlignment: Text.AlignVCenter
         horizontalAlignment: Text.AlignHCenter
-        leftPadding: DeviceSpecs.hasRoundScreen ? Dims.w(25) : 0
-        rightPadding: DeviceSpecs.hasRoundScreen ? Dims.w(25) : 0
+        leftPadding: DeviceSpecs.hasRoundScreen ? Dims.widthUnit * 25 : 0
+        rightPadding: DeviceSpecs.hasRoundScreen ? Dims.widthUnit * 25 : 0
         wrapMode: Text.WordWrap
         maximumLineCount: 2
     }
@@ -153,7 +153,7 @@ Rectangle {
             horizontalCenter: parent.horizontalCenter
             verticalCenter: parent.verticalCenter
         }
-        width: Dims.l(22)
+        width: Dims.lengthUnit * 22
         height: width
         segmentAmount: remorseTimer.gaugeSegmentAmount
         inputValue: remorseTimer.arcValue
@@ -167,7 +167,7 @@ Rectangle {
         id: countdownLabel
         anchors.centerIn: countdownArc
         font {
-            pixelSize: Dims.l(18)
+            pixelSize: Dims.lengthUnit * 18
             styleName: "SemiBoldCondensed"
         }
         color: "#ffffff"
@@ -180,9 +180,9 @@ Rectangle {
         anchors {
             horizontalCenter: parent.horizontalCenter
             bottom: countdownArc.top
-            bottomMargin: Dims.l(1)
+            bottomMargin: Dims.lengthUnit * 1
         }
-        font.pixelSize: Dims.l(6)
+        font.pixelSize: Dims.lengthUnit * 6
         color: "#ffffff"
         text: action
     }
@@ -192,9 +192,9 @@ Rectangle {
         anchors {
             horizontalCenter: parent.horizontalCenter
             top: countdownArc.bottom
-            topMargin: Dims.l(1)
+            topMargin: Dims.lengthUnit * 1
         }
-        font.pixelSize: Dims.l(6)
+        font.pixelSize: Dims.lengthUnit * 6
         color: "#ffffff"
     }
 
@@ -52,10 +52,10 @@ ListView {
     property alias showSeparator: separator.visible
 
     id: lv
-    preferredHighlightBegin: height / 2 - Dims.h(5)
-    preferredHighlightEnd: height / 2 + Dims.h(5)
+    preferredHighlightBegin: height / 2 - Dims.heightUnit * 5
+    preferredHighlightEnd: height / 2 + Dims.heightUnit * 5
     highlightRangeMode: ListView.StrictlyEnforceRange
-    spacing: Dims.h(2)
+    spacing: Dims.heightUnit * 2
     clip: true
 
     delegate: SpinnerDelegate { }
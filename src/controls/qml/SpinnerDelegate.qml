@@ -90,7 +90,7 @@ Label {
     property bool isCurr: isCircularSpinner ? PathView.isCurrentItem : ListView.isCurrentItem
 
     width: isCircularSpinner ? PathView.view.width : ListView.view.width
-    height: Dims.h(10)
+    height: Dims.heightUnit * 10
 
     function zeroPadding(x) {
         if (x<10) return "0"+x;
@@ -62,7 +62,7 @@ Item {
     Rectangle {
         id: statusBackground
         anchors.centerIn: parent
-        anchors.verticalCenterOffset: -Dims.h(13)
+        anchors.verticalCenterOffset: -Dims.heightUnit * 13
         color: "black"
         radius: width/2
         opacity: activeBackground ? 0.4 : 0.2
@@ -72,7 +72,7 @@ Item {
     Icon {
         id: statusIcon
         anchors.fill: statusBackground
-        anchors.margins: Dims.l(3)
+        anchors.margins: Dims.lengthUnit * 3
     }
     MouseArea {
         id: statusMA
@@ -83,13 +83,13 @@ Item {
 
     Label {
         id: statusLabel
-        font.pixelSize: Dims.l(5)
+        font.pixelSize: Dims.lengthUnit * 5
         horizontalAlignment: Text.AlignHCenter
         verticalAlignment: Text.AlignVCenter
         wrapMode: Text.Wrap
         anchors.left: parent.left; anchors.right: parent.right
-        anchors.leftMargin: Dims.w(4); anchors.rightMargin: anchors.leftMargin
+        anchors.leftMargin: Dims.widthUnit * 4; anchors.rightMargin: anchors.leftMargin
         anchors.verticalCenter: parent.verticalCenter
-        anchors.verticalCenterOffset: Dims.h(15)
+        anchors.verticalCenterOffset: Dims.heightUnit * 15
     }
 }
@@ -48,7 +48,7 @@ import org.asteroid.controls
         Switch {
             anchors.top: square.bottom
             anchors.horizontalCenter: parent.horizontalCenter
-            width: Dims.l(20)
+            width: Dims.lengthUnit * 20
             onCheckedChanged: { 
                 if (checked) 
                     square.color = "green"
@@ -62,7 +62,7 @@ import org.asteroid.controls
 Item {
     property bool checked
 
-    width: Dims.l(30)
+    width: Dims.lengthUnit * 30
     height: width
 
     Icon {
@@ -49,8 +49,8 @@ import org.asteroid.controls
     import org.asteroid.controls
 
     ValueMeter {
-        width: Dims.l(28) * 1.8
-        height: Dims.l(8)
+        width: Dims.lengthUnit * 28 * 1.8
+        height: Dims.lengthUnit * 8
         valueLowerBound: 0
         valueUpperBound: 100
         value: 75
@@ -67,13 +67,13 @@ Item {
         \qmlproperty real ValueMeter::width
         The width of the meter.
     */
-    width: Dims.l(28) * 1.8
+    width: Dims.lengthUnit * 28 * 1.8
 
     /*!
         \qmlproperty real ValueMeter::height
         The height of the meter.
     */
-    height: Dims.l(8)
+    height: Dims.lengthUnit * 8
 
     /*!
         \qmlproperty real ValueMeter::valueLowerBound
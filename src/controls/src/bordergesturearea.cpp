@@ -0,0 +1,476 @@
+/*
+ * Copyright (C) 2015 Florent Revest <revestflo@gmail.com>
+ *               2014 Aleksi Suomalainen <suomalainen.aleksi@gmail.com>
+ *               2013 John Brooks <john.brooks@dereferenced.net>
+ * All rights reserved.
+ *
+ * You may use this file under the terms of BSD license as follows:
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the author nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "bordergesturearea.h"
+
+#include "machineconfig.h"
+
+#include <QMouseEvent>
+
+// Weight of the latest sample in the smoothed velocity.
+static const qreal VELOCITY_SMOOTHING = 0.6;
+// A finger resting longer than this before lifting has no fling velocity.
+static const quint64 VELOCITY_TIMEOUT = 50;
+
+/*!
+    \qmltype BorderGestureArea
+    \inqmlmodule org.asteroid.controls
+
+    \brief Provides simple gesture support for swiping up, down, left, right.
+
+    Gestures start when a touch lands within \l boundary of an edge that
+    accepts them. While the finger moves, \l value follows it along the
+    gesture axis and \l velocity holds a smoothed estimate of its speed,
+    which is still available in \c onGestureFinished to complete gestures
+    that were flung rather than dragged all the way. \l predictionTime
+    extrapolates \l value along that velocity to hide input latency.
+
+    BorderGestureArea used to be a MouseArea. It keeps the \l pressed,
+    \l mouseX, \l mouseY and \l preventStealing properties and \c enabled
+    still turns input off, but the MouseArea signals carrying a mouse event
+    (\c pressed, \c released, \c positionChanged, \c clicked) are gone: use
+    gestureStarted(), gestureFinished(), \l value and canceled() instead.
+
+    A simple example, based on the example for \l Application is shown below.  If
+    the user swipes right, the rectangle turns red.  If the user swipes left, 
+    the rectangle turns blue.  If the user swipes down, the rectangle turns 
+    yellow.  No action is assigned to swipes up.
+
+    \qml
+    import QtQuick
+    import org.asteroid.controls
+
+    Application {
+        id: myapp
+        centerColor: "#00010B"
+        outerColor: "#E044A6"
+        rightIndicVisible: true
+        bottomIndicVisible: true
+
+        BorderGestureArea {
+            id: gestureArea
+            anchors.fill: parent
+            acceptsRight: true
+            acceptsLeft: true
+            acceptsDown: true
+            onGestureFinished: (gesture) => {
+                if (gesture == "right") {
+                    square.color = "red"
+                }
+                else if (gesture == "left") {
+                    square.color = "blue"
+                }
+                else {
+                    square.color = "yellow"
+                }
+            }
+        }
+
+        Rectangle {
+            id: square
+            anchors.centerIn: parent
+            color: "yellow"
+            width: parent.width * 0.4
+            height: parent.height * 0.2
+        }
+    }
+    \endqml
+
+    Also note that it is possible to use a \l BorderGestureArea inside
+    other containers.  For example, one could add the following inside
+    the \l Rectangle in the example above.  Within the rectangle, swipes up 
+    turn the \l Rectangle green and swipes down turn it orange.
+
+    \qml
+    BorderGestureArea {
+        id: innerGestureArea
+        anchors.fill: parent
+        acceptsUp: true
+        acceptsDown: true
+        onGestureFinished: (gesture) => {
+            if (gesture == "up") {
+                square.color = "green"
+            }
+            else {
+                square.color = "orange"
+            }
+        }
+    }
+    \endqml
+
+*/
+
+/*!
+    \qmlsignal BorderGestureArea::gestureStarted(string gesture)
+    \brief Emitted when a touch starts a \a gesture on one of the accepted edges.
+*/
+
+/*!
+    \qmlsignal BorderGestureArea::gestureFinished(string gesture)
+    \brief Emitted when the finger performing \a gesture is lifted.
+*/
+
+/*!
+    \qmlsignal BorderGestureArea::canceled()
+    \brief Emitted when another item takes the touch away during a gesture.
+
+    gestureFinished() follows, with a \l velocity of 0.
+*/
+
+BorderGestureArea::BorderGestureArea(QQuickItem *parent) : QQuickItem(parent)
+{
+    m_boundary = -1;
+    m_delayReset = false;
+    m_gesture = NoGesture;
+    m_value = 0;
+    m_max = 0;
+    m_velocity = 0;
+    m_predictionTime = 16;
+    m_acceptsRight = m_acceptsLeft = m_acceptsDown = m_acceptsUp = false;
+    m_pressed = false;
+    m_preventStealing = false;
+    m_start = 0;
+    m_lastPosition = 0;
+    m_lastTimestamp = 0;
+
+    setAcceptedMouseButtons(Qt::LeftButton);
+    connect(MachineConfig::instance(), &MachineConfig::changed, this, [this]() {
+        if (m_boundary < 0)
+            emit boundaryChanged();
+    });
+}
+
+/*!
+    \qmlproperty int BorderGestureArea::boundary
+    \brief Width of the edge areas in which gestures can start.
+
+    Defaults to the border gesture width of the device.
+*/
+int BorderGestureArea::boundary() const
+{
+    return m_boundary >= 0 ? m_boundary : int(width() * MachineConfig::data().borderGestureWidth);
+}
+
+void BorderGestureArea::setBoundary(int boundary)
+{
+    if (m_boundary == boundary)
+        return;
+    m_boundary = boundary;
+    emit boundaryChanged();
+}
+
+void BorderGestureArea::resetBoundary()
+{
+    setBoundary(-1);
+}
+
+void BorderGestureArea::setDelayReset(bool delayReset)
+{
+    if (m_delayReset == delayReset)
+        return;
+    m_delayReset = delayReset;
+    emit delayResetChanged();
+    if (!m_delayReset)
+        reset();
+}
+
+/*!
+    \qmlproperty bool BorderGestureArea::active
+    \brief True if the current gesture active.
+*/
+
+/*!
+    \qmlproperty string BorderGestureArea::gesture
+    \brief Describes the current gesture.
+
+    The string is "down", "left", "up" or "right" if the
+    user has gestured.  Otherwise the string is empty.
+*/
+QString BorderGestureArea::gesture() const
+{
+    switch (m_gesture) {
+    case Down:  return QStringLiteral("down");
+    case Left:  return QStringLiteral("left");
+    case Up:    return QStringLiteral("up");
+    case Right: return QStringLiteral("right");
+    default:    return QString();
+    }
+}
+
+/*!
+    \qmlproperty enumeration BorderGestureArea::gestureType
+    \brief The current gesture as an enumeration value.
+
+    \value BorderGestureArea.NoGesture no gesture is in progress
+    \value BorderGestureArea.Down swipe down from the top edge
+    \value BorderGestureArea.Left swipe left from the right edge
+    \value BorderGestureArea.Up swipe up from the bottom edge
+    \value BorderGestureArea.Right swipe right from the left edge
+*/
+
+/*!
+    \qmlproperty real BorderGestureArea::value
+    \brief Distance travelled by the finger along the gesture axis.
+*/
+void BorderGestureArea::setValue(qreal value)
+{
+    if (qFuzzyCompare(m_value, value))
+        return;
+    m_value = value;
+    emit valueChanged();
+    emit progressChanged();
+}
+
+void BorderGestureArea::setMax(qreal max)
+{
+    if (qFuzzyCompare(m_max, max))
+        return;
+    m_max = max;
+    emit maxChanged();
+    emit progressChanged();
+}
+
+/*!
+    \qmlproperty real BorderGestureArea::progress
+    \brief Ratio between \l value and the largest value the gesture can reach.
+*/
+qreal BorderGestureArea::progress() const
+{
+    return m_max > 0 ? qAbs(m_value) / m_max : 0;
+}
+
+/*!
+    \qmlproperty real BorderGestureArea::velocity
+    \brief Smoothed speed of the finger along the gesture axis, in pixels per second.
+*/
+void BorderGestureArea::setVelocity(qreal velocity)
+{
+    if (qFuzzyCompare(m_velocity, velocity))
+        return;
+    m_velocity = velocity;
+    emit velocityChanged();
+}
+
+/*!
+    \qmlproperty int BorderGestureArea::predictionTime
+    \brief How far ahead, in milliseconds, \l value is extrapolated during a gesture.
+
+    Set to 0 to report raw touch positions.
+*/
+void BorderGestureArea::setPredictionTime(int ms)
+{
+    if (m_predictionTime == ms)
+        return;
+    m_predictionTime = ms;
+    emit predictionTimeChanged();
+}
+
+/*!
+    \qmlproperty bool BorderGestureArea::pressed
+    \brief True while a finger that started a gesture is down.
+*/
+void BorderGestureArea::setPressed(bool pressed)
+{
+    if (m_pressed == pressed)
+        return;
+    m_pressed = pressed;
+    emit pressedChanged();
+}
+
+/*!
+    \qmlproperty real BorderGestureArea::mouseX
+    \brief Horizontal position of the finger, updated while \l pressed.
+*/
+
+/*!
+    \qmlproperty real BorderGestureArea::mouseY
+    \brief Vertical position of the finger, updated while \l pressed.
+*/
+void BorderGestureArea::setMousePosition(const QPointF &position)
+{
+    const QPointF old = m_mousePosition;
+    m_mousePosition = position;
+    if (old.x() != position.x())
+        emit mouseXChanged();
+    if (old.y() != position.y())
+        emit mouseYChanged();
+}
+
+/*!
+    \qmlproperty bool BorderGestureArea::preventStealing
+    \brief Keeps a gesture from being taken over by a Flickable or another area
+    underneath once it has started.
+*/
+void BorderGestureArea::setPreventStealing(bool preventStealing)
+{
+    if (m_preventStealing == preventStealing)
+        return;
+    m_preventStealing = preventStealing;
+    setKeepMouseGrab(preventStealing && m_pressed);
+    emit preventStealingChanged();
+}
+
+/*!
+    \qmlproperty bool BorderGestureArea::horizontal
+    \brief True if gesture is left or right.
+*/
+
+/*!
+    \qmlproperty bool BorderGestureArea::acceptsRight
+    \brief Tells the BorderGestureArea to accept right gestures.
+*/
+
+/*!
+    \qmlproperty bool BorderGestureArea::acceptsLeft
+    \brief Tells the BorderGestureArea to accept left gestures.
+*/
+
+/*!
+    \qmlproperty bool BorderGestureArea::acceptsDown
+    \brief Tells the BorderGestureArea to accept down gestures.
+*/
+
+/*!
+    \qmlproperty bool BorderGestureArea::acceptsUp
+    \brief Tells the BorderGestureArea to accept up gestures.
+*/
+
+void BorderGestureArea::reset()
+{
+    const bool changed = m_gesture != NoGesture;
+    m_gesture = NoGesture;
+    m_start = 0;
+    setValue(0);
+    setMax(0);
+    setVelocity(0);
+    if (changed)
+        emit gestureChanged();
+}
+
+qreal BorderGestureArea::axisPosition(const QPointF &position) const
+{
+    return horizontal() ? position.x() : position.y();
+}
+
+void BorderGestureArea::mousePressEvent(QMouseEvent *event)
+{
+    const QPointF pos = event->position();
+    const int edge = boundary();
+
+    Gesture gesture;
+    qreal max;
+    if (pos.x() < edge && m_acceptsRight) {
+        gesture = Right;
+        max = width() - pos.x();
+    } else if (width() - pos.x() < edge && m_acceptsLeft) {
+        gesture = Left;
+        max = pos.x();
+    } else if (pos.y() < edge && m_acceptsDown) {
+        gesture = Down;
+        max = height() - pos.y();
+    } else if (height() - pos.y() < edge && m_acceptsUp) {
+        gesture = Up;
+        max = pos.y();
+    } else {
+        event->ignore();
+        return;
+    }
+
+    m_gesture = gesture;
+    m_start = axisPosition(pos);
+    m_lastPosition = m_start;
+    m_lastTimestamp = event->timestamp();
+    setMax(max);
+    setValue(0);
+    setVelocity(0);
+    setKeepMouseGrab(m_preventStealing);
+    setMousePosition(pos);
+    setPressed(true);
+    emit gestureChanged();
+    emit gestureStarted(this->gesture());
+}
+
+void BorderGestureArea::mouseMoveEvent(QMouseEvent *event)
+{
+    if (!m_pressed)
+        return;
+
+    setMousePosition(event->position());
+    const qreal pos = axisPosition(event->position());
+    const quint64 timestamp = event->timestamp();
+    if (timestamp > m_lastTimestamp) {
+        const qreal sample = (pos - m_lastPosition) * 1000 / (timestamp - m_lastTimestamp);
+        setVelocity(VELOCITY_SMOOTHING * sample + (1 - VELOCITY_SMOOTHING) * m_velocity);
+    }
+    m_lastPosition = pos;
+    m_lastTimestamp = timestamp;
+
+    const qreal predicted = pos + m_velocity * m_predictionTime / 1000;
+    setValue(qBound(-m_max, predicted - m_start, m_max));
+}
+
+void BorderGestureArea::mouseReleaseEvent(QMouseEvent *event)
+{
+    if (!m_pressed)
+        return;
+
+    if (event->timestamp() - m_lastTimestamp > VELOCITY_TIMEOUT)
+        setVelocity(0);
+    setMousePosition(event->position());
+    setValue(qBound(-m_max, axisPosition(event->position()) - m_start, m_max));
+    finish();
+}
+
+void BorderGestureArea::mouseUngrabEvent()
+{
+    if (!m_pressed)
+        return;
+
+    setVelocity(0);
+    emit canceled();
+    finish();
+}
+
+void BorderGestureArea::finish()
+{
+    setKeepMouseGrab(false);
+    setPressed(false);
+    emit gestureFinished(gesture());
+    if (!m_delayReset)
+        reset();
+}
+
+void BorderGestureArea::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (m_boundary < 0 && newGeometry.width() != oldGeometry.width())
+        emit boundaryChanged();
+}
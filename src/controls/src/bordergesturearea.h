@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2015 Florent Revest <revestflo@gmail.com>
+ *               2014 Aleksi Suomalainen <suomalainen.aleksi@gmail.com>
+ *               2013 John Brooks <john.brooks@dereferenced.net>
+ * All rights reserved.
+ *
+ * You may use this file under the terms of BSD license as follows:
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the author nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDERS OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BORDERGESTUREAREA_H
+#define BORDERGESTUREAREA_H
+
+#include <QQuickItem>
+#include <QtQml/qqmlregistration.h>
+
+class BorderGestureArea : public QQuickItem
+{
+    Q_OBJECT
+    QML_NAMED_ELEMENT(BorderGestureArea)
+    Q_PROPERTY(int boundary READ boundary WRITE setBoundary RESET resetBoundary NOTIFY boundaryChanged)
+    Q_PROPERTY(bool delayReset READ delayReset WRITE setDelayReset NOTIFY delayResetChanged)
+    Q_PROPERTY(bool active READ active NOTIFY gestureChanged)
+    Q_PROPERTY(QString gesture READ gesture NOTIFY gestureChanged)
+    Q_PROPERTY(Gesture gestureType READ gestureType NOTIFY gestureChanged)
+    Q_PROPERTY(qreal value READ value WRITE setValue NOTIFY valueChanged)
+    Q_PROPERTY(qreal max READ max NOTIFY maxChanged)
+    Q_PROPERTY(qreal progress READ progress NOTIFY progressChanged)
+    Q_PROPERTY(qreal velocity READ velocity NOTIFY velocityChanged)
+    Q_PROPERTY(int predictionTime READ predictionTime WRITE setPredictionTime NOTIFY predictionTimeChanged)
+    Q_PROPERTY(bool horizontal READ horizontal NOTIFY gestureChanged)
+    Q_PROPERTY(bool inverted READ inverted NOTIFY gestureChanged)
+    Q_PROPERTY(bool acceptsRight MEMBER m_acceptsRight NOTIFY acceptsChanged)
+    Q_PROPERTY(bool acceptsLeft MEMBER m_acceptsLeft NOTIFY acceptsChanged)
+    Q_PROPERTY(bool acceptsDown MEMBER m_acceptsDown NOTIFY acceptsChanged)
+    Q_PROPERTY(bool acceptsUp MEMBER m_acceptsUp NOTIFY acceptsChanged)
+    // Kept from the MouseArea this type used to be
+    Q_PROPERTY(bool pressed READ pressed NOTIFY pressedChanged)
+    Q_PROPERTY(qreal mouseX READ mouseX NOTIFY mouseXChanged)
+    Q_PROPERTY(qreal mouseY READ mouseY NOTIFY mouseYChanged)
+    Q_PROPERTY(bool preventStealing READ preventStealing WRITE setPreventStealing NOTIFY preventStealingChanged)
+
+public:
+    enum Gesture { NoGesture, Down, Left, Up, Right };
+    Q_ENUM(Gesture)
+
+    explicit BorderGestureArea(QQuickItem *parent = nullptr);
+
+    int boundary() const;
+    void setBoundary(int boundary);
+    void resetBoundary();
+
+    bool delayReset() const { return m_delayReset; }
+    void setDelayReset(bool delayReset);
+
+    bool active() const { return m_gesture != NoGesture; }
+    QString gesture() const;
+    Gesture gestureType() const { return m_gesture; }
+
+    qreal value() const { return m_value; }
+    void setValue(qreal value);
+    qreal max() const { return m_max; }
+    qreal progress() const;
+    qreal velocity() const { return m_velocity; }
+
+    int predictionTime() const { return m_predictionTime; }
+    void setPredictionTime(int ms);
+
+    bool horizontal() const { return m_gesture == Left || m_gesture == Right; }
+    bool inverted() const { return m_gesture == Left || m_gesture == Up; }
+
+    bool pressed() const { return m_pressed; }
+    qreal mouseX() const { return m_mousePosition.x(); }
+    qreal mouseY() const { return m_mousePosition.y(); }
+    bool preventStealing() const { return m_preventStealing; }
+    void setPreventStealing(bool preventStealing);
+
+    Q_INVOKABLE void reset();
+
+signals:
+    void gestureStarted(const QString &gesture);
+    void gestureFinished(const QString &gesture);
+    void boundaryChanged();
+    void delayResetChanged();
+    void gestureChanged();
+    void valueChanged();
+    void maxChanged();
+    void progressChanged();
+    void velocityChanged();
+    void predictionTimeChanged();
+    void acceptsChanged();
+    void pressedChanged();
+    void mouseXChanged();
+    void mouseYChanged();
+    void preventStealingChanged();
+    void canceled();
+
+protected:
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void mouseUngrabEvent() override;
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+
+private:
+    qreal axisPosition(const QPointF &position) const;
+    void setMax(qreal max);
+    void setVelocity(qreal velocity);
+    void setPressed(bool pressed);
+    void setMousePosition(const QPointF &position);
+    void finish();
+
+    int m_boundary;
+    bool m_delayReset;
+    Gesture m_gesture;
+    qreal m_value;
+    qreal m_max;
+    qreal m_velocity;
+    int m_predictionTime;
+    bool m_acceptsRight, m_acceptsLeft, m_acceptsDown, m_acceptsUp;
+
+    bool m_pressed;
+    bool m_preventStealing;
+    QPointF m_mousePosition;
+    qreal m_start;
+    qreal m_lastPosition;
+    quint64 m_lastTimestamp;
+};
+
+#endif // BORDERGESTUREAREA_H
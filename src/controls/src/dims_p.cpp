@@ -0,0 +1,60 @@
+/*
+ * Part of this code is based on QML-Material (https://github.com/papyros/qml-material/)
+ * Asteroid Modificatons
+ * Copyright (C) 2017 Florent Revest <revestflo@gmail.com>
+ * Copyright (C) 2015 Tim Süberkrüb (https://github.com/tim-sueberkrueb)
+ * QML Material - An application framework implementing Material Design.
+ * Copyright (C) 2014-2015 Michael Spencer <sonrisesoftware@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dims_p.h"
+#include "machineconfig.h"
+
+#include <QGuiApplication>
+#include <QScreen>
+
+Dims_p::Dims_p(QObject *parent) : QObject(parent)
+{
+    m_screenWidth = 0;
+    m_screenHeight = 0;
+
+    connect(qGuiApp, &QGuiApplication::primaryScreenChanged, this, &Dims_p::setScreen);
+    connect(MachineConfig::instance(), &MachineConfig::changed, this, &Dims_p::updateMetrics);
+    setScreen(QGuiApplication::primaryScreen());
+}
+
+void Dims_p::setScreen(QScreen *screen)
+{
+    if (m_screen)
+        disconnect(m_screen, nullptr, this, nullptr);
+    m_screen = screen;
+    if (m_screen)
+        connect(m_screen, &QScreen::availableVirtualGeometryChanged, this, &Dims_p::updateMetrics);
+    updateMetrics();
+}
+
+void Dims_p::updateMetrics()
+{
+    const QSize available = m_screen ? m_screen->availableVirtualGeometry().size() : QSize();
+    const qreal width = available.width();
+    const qreal height = available.height() + MachineConfig::data().flatTireHeight;
+
+    if (width == m_screenWidth && height == m_screenHeight)
+        return;
+    m_screenWidth = width;
+    m_screenHeight = height;
+    emit metricsChanged();
+}
@@ -0,0 +1,75 @@
+/*
+ * Part of this code is based on QML-Material (https://github.com/papyros/qml-material/)
+ * Asteroid Modificatons
+ * Copyright (C) 2017 Florent Revest <revestflo@gmail.com>
+ * Copyright (C) 2015 Tim Süberkrüb (https://github.com/tim-sueberkrueb)
+ * QML Material - An application framework implementing Material Design.
+ * Copyright (C) 2014-2015 Michael Spencer <sonrisesoftware@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DIMS_P_H
+#define DIMS_P_H
+
+#include <QObject>
+#include <QPointer>
+#include <QtQml/qqmlregistration.h>
+
+class QScreen;
+
+/*
+ * Screen metrics behind the Dims singleton of Dims.qml.
+ *
+ * The available screen size and the flat tire height are read once and only
+ * read again when the primary screen or its available geometry changes.
+ */
+class Dims_p : public QObject
+{
+    Q_OBJECT
+    QML_NAMED_ELEMENT(Dims_p)
+    QML_SINGLETON
+    Q_PROPERTY(qreal screenWidth READ screenWidth NOTIFY metricsChanged)
+    Q_PROPERTY(qreal screenHeight READ screenHeight NOTIFY metricsChanged)
+    Q_PROPERTY(qreal widthUnit READ widthUnit NOTIFY metricsChanged)
+    Q_PROPERTY(qreal heightUnit READ heightUnit NOTIFY metricsChanged)
+    Q_PROPERTY(qreal lengthUnit READ lengthUnit NOTIFY metricsChanged)
+    Q_PROPERTY(qreal iconButtonMargin READ iconButtonMargin NOTIFY metricsChanged)
+    Q_PROPERTY(qreal defaultFontSize READ defaultFontSize NOTIFY metricsChanged)
+
+public:
+    explicit Dims_p(QObject *parent = nullptr);
+
+    qreal screenWidth() const { return m_screenWidth; }
+    qreal screenHeight() const { return m_screenHeight; }
+    qreal widthUnit() const { return m_screenWidth / 100; }
+    qreal heightUnit() const { return m_screenHeight / 100; }
+    qreal lengthUnit() const { return qMin(m_screenWidth, m_screenHeight) / 100; }
+    qreal iconButtonMargin() const { return 3 * lengthUnit(); }
+    qreal defaultFontSize() const { return 7 * lengthUnit(); }
+
+signals:
+    void metricsChanged();
+
+private slots:
+    void setScreen(QScreen *screen);
+    void updateMetrics();
+
+private:
+    QPointer<QScreen> m_screen;
+    qreal m_screenWidth;
+    qreal m_screenHeight;
+};
+
+#endif // DIMS_P_H
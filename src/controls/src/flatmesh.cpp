@@ -29,6 +29,7 @@
 
 #include "flatmesh.h"
 #include "flatmeshnode.h"
+#include "machineconfig.h"
 
 FlatMesh::FlatMesh(QQuickItem *parent) : QQuickItem(parent)
 {
@@ -37,6 +38,9 @@ FlatMesh::FlatMesh(QQuickItem *parent) : QQuickItem(parent)
     connect(&m_timer, SIGNAL(timeout()), this, SLOT(update()));
     m_timer.start();
 
+    // Read here as the node is created on the render thread.
+    m_roundScreen = MachineConfig::data().roundScreen;
+
     m_centerColor = QColor("#ffaa39");
     m_outerColor = QColor("#df4829");
 
@@ -85,7 +89,7 @@ QSGNode *FlatMesh::updatePaintNode(QSGNode *old, UpdatePaintNodeData *)
 {
     FlatMeshNode *n = static_cast<FlatMeshNode *>(old);
     if (!n)
-        n = new FlatMeshNode(window(), boundingRect());
+        n = new FlatMeshNode(window(), boundingRect(), m_roundScreen);
 
     n->setAnimated(m_animated);
     n->setRect(boundingRect());
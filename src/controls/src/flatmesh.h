@@ -68,6 +68,7 @@ private slots:
 private:
     QColor m_centerColor, m_outerColor;
     bool m_animated;
+    bool m_roundScreen;
     QTimer m_timer;
 };
 
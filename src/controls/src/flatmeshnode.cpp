@@ -34,7 +34,6 @@
 
 #include <QScreen>
 #include <QElapsedTimer>
-#include <QSettings>
 
 /* Used to compute a triangle color from its distance to the center */
 static inline QColor interpolateColors(const QColor& color1, const QColor& color2, qreal ratio)
@@ -50,14 +49,13 @@ static inline QColor interpolateColors(const QColor& color1, const QColor& color
     return QColor(r, g, b);
 }
 
-FlatMeshNode::FlatMeshNode(QQuickWindow *window, QRectF boundingRect)
+FlatMeshNode::FlatMeshNode(QQuickWindow *window, QRectF boundingRect, bool roundScreen)
     : QSGSimpleRectNode(boundingRect, Qt::transparent),
       m_animationState(0), m_animated(true), m_window(window), m_loopCount(0)
 {
     connect(window, SIGNAL(afterRendering()), this, SLOT(maybeAnimate()));
 
-    QSettings machineConf("/etc/asteroid/machine.conf", QSettings::IniFormat);
-    m_screenScaleFactor = machineConf.value("Display/ROUND", false).toBool() ? 1.2f : 1.7f;
+    m_screenScaleFactor = roundScreen ? 1.2f : 1.7f;
 
     /* Create triangle nodes based on pre-computed indices */
     int numTriangles = flatmesh_indices_sz / 3;
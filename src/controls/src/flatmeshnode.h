@@ -55,7 +55,7 @@ class FlatMeshNode : public QObject, public QSGSimpleRectNode
 {
     Q_OBJECT
 public:
-    FlatMeshNode(QQuickWindow *window, QRectF rect);
+    FlatMeshNode(QQuickWindow *window, QRectF rect, bool roundScreen);
     void setAnimated(bool animated);
 
     void setCenterColor(QColor c);
@@ -0,0 +1,384 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "layerstack_p.h"
+
+#include <QDebug>
+#include <QJSValueIterator>
+#include <QQmlContext>
+#include <QQmlEngine>
+#include <QQmlIncubator>
+#include <QQmlProperty>
+#include <QQuickWindow>
+
+class LayerIncubator : public QQmlIncubator
+{
+public:
+    explicit LayerIncubator(std::function<void(LayerIncubator *, QObject *)> onDone)
+        : QQmlIncubator(Asynchronous), m_onDone(onDone) {}
+
+    QPointer<QQuickItem> item;
+
+protected:
+    void statusChanged(Status status) override
+    {
+        if (status == Ready) {
+            m_onDone(this, object());
+        } else if (status == Error) {
+            qWarning() << "LayerStack: failed to create layer" << errors();
+            m_onDone(this, nullptr);
+        }
+    }
+
+private:
+    std::function<void(LayerIncubator *, QObject *)> m_onDone;
+};
+
+// Functions (e.g. the pop() callback handed to pages) are kept as QJSValue so
+// that they can be assigned to var properties.
+static QVariantMap toPropertyMap(const QJSValue &params)
+{
+    QVariantMap map;
+    if (!params.isObject())
+        return map;
+
+    QJSValueIterator it(params);
+    while (it.hasNext()) {
+        it.next();
+        const QJSValue value = it.value();
+        map.insert(it.name(), value.isCallable() ? QVariant::fromValue(value) : value.toVariant());
+    }
+    return map;
+}
+
+LayerStack_p::LayerStack_p(QQuickItem *parent) : QQuickItem(parent)
+{
+    m_pendingPush = nullptr;
+    m_asynchronous = false;
+    m_cacheSize = 0;
+    m_trimDepth = 4;
+    m_transitioning = false;
+}
+
+LayerStack_p::~LayerStack_p()
+{
+    qDeleteAll(m_incubators);
+}
+
+void LayerStack_p::setFirstPage(QQmlComponent *component)
+{
+    if (m_firstPage == component)
+        return;
+    m_firstPage = component;
+    emit firstPageChanged();
+
+    if (isComponentComplete())
+        createFirstPage();
+}
+
+void LayerStack_p::componentComplete()
+{
+    QQuickItem::componentComplete();
+    if (m_firstPage)
+        createFirstPage();
+}
+
+void LayerStack_p::createFirstPage()
+{
+    if (m_firstPageItem) {
+        destroyLayer(m_firstPageItem);
+        m_firstPageItem = nullptr;
+        emit firstPageItemChanged();
+    }
+    while (!m_layers.isEmpty())
+        pop(m_layers.last().item);
+
+    if (!m_firstPage) {
+        qWarning("LayerStack: firstpage has been updated with a null value");
+        return;
+    }
+    if (m_firstPage->status() != QQmlComponent::Ready)
+        return;
+
+    createLayer(m_firstPage, QVariantMap(), m_asynchronous, [this](QQuickItem *item) {
+        m_firstPageItem = item;
+        item->setParentItem(this);
+        updateLayers();
+        emit firstPageItemChanged();
+        emit layersChanged();
+    }, true);
+}
+
+qsizetype LayerStack_p::layerCount(QQmlListProperty<QQuickItem> *list)
+{
+    return static_cast<LayerStack_p *>(list->object)->m_layers.size();
+}
+
+QQuickItem *LayerStack_p::layerAt(QQmlListProperty<QQuickItem> *list, qsizetype index)
+{
+    return static_cast<LayerStack_p *>(list->object)->m_layers.at(index).item;
+}
+
+QQmlListProperty<QQuickItem> LayerStack_p::layers()
+{
+    return QQmlListProperty<QQuickItem>(this, nullptr, &LayerStack_p::layerCount, &LayerStack_p::layerAt);
+}
+
+QQuickItem *LayerStack_p::currentLayer() const
+{
+    return m_layers.isEmpty() ? nullptr : m_layers.last().item.data();
+}
+
+void LayerStack_p::setAsynchronous(bool asynchronous)
+{
+    if (m_asynchronous == asynchronous)
+        return;
+    m_asynchronous = asynchronous;
+    emit asynchronousChanged();
+}
+
+void LayerStack_p::setCacheSize(int size)
+{
+    size = qMax(size, 0);
+    if (m_cacheSize == size)
+        return;
+    m_cacheSize = size;
+    while (m_cache.size() > m_cacheSize)
+        destroyLayer(m_cache.takeFirst().item);
+    emit cacheSizeChanged();
+}
+
+void LayerStack_p::setTrimDepth(int depth)
+{
+    if (m_trimDepth == depth)
+        return;
+    m_trimDepth = depth;
+    emit trimDepthChanged();
+}
+
+void LayerStack_p::setTransitioning(bool transitioning)
+{
+    if (m_transitioning == transitioning)
+        return;
+    m_transitioning = transitioning;
+    updateLayers();
+    emit transitioningChanged();
+}
+
+QQuickItem *LayerStack_p::push(QQmlComponent *component, const QJSValue &params)
+{
+    if (!component || component->status() != QQmlComponent::Ready)
+        return nullptr;
+
+    // Only one layer is incubated for a push at a time, finish it first so
+    // that depths stay in order.
+    if (m_pendingPush)
+        m_pendingPush->forceCompletion();
+
+    QVariantMap properties = toPropertyMap(params);
+    properties.insert("depth", m_layers.size() + 1);
+
+    if (QQuickItem *item = takeCached(component)) {
+        for (auto it = properties.cbegin(); it != properties.cend(); ++it) {
+            QQmlProperty property(item, it.key());
+            if (property.isWritable())
+                property.write(it.value());
+        }
+        showLayer(item, component);
+        return item;
+    }
+
+    QPointer<QQmlComponent> guard(component);
+    return createLayer(component, properties, m_asynchronous, [this, guard](QQuickItem *item) {
+        showLayer(item, guard);
+    }, true);
+}
+
+void LayerStack_p::preload(QQmlComponent *component, const QJSValue &params)
+{
+    if (!component || component->status() != QQmlComponent::Ready)
+        return;
+
+    QPointer<QQmlComponent> guard(component);
+    createLayer(component, toPropertyMap(params), true, [this, guard](QQuickItem *item) {
+        m_preloaded.append({ item, guard });
+    }, false);
+}
+
+void LayerStack_p::pop(QQuickItem *item)
+{
+    if (m_layers.isEmpty())
+        return;
+
+    int index = m_layers.size() - 1;
+    for (int i = 0; i < m_layers.size(); ++i) {
+        if (m_layers.at(i).item == item)
+            index = i;
+    }
+
+    const Layer layer = m_layers.takeAt(index);
+    if (m_cacheSize > 0 && layer.item && layer.component) {
+        layer.item->setParentItem(nullptr);
+        m_cache.append(layer);
+        while (m_cache.size() > m_cacheSize)
+            destroyLayer(m_cache.takeFirst().item);
+    } else {
+        destroyLayer(layer.item);
+    }
+
+    updateLayers();
+    emit layersChanged();
+    emit layerPopped();
+}
+
+void LayerStack_p::clearCache()
+{
+    while (!m_preloaded.isEmpty())
+        destroyLayer(m_preloaded.takeLast().item);
+    while (!m_cache.isEmpty())
+        destroyLayer(m_cache.takeLast().item);
+}
+
+QQuickItem *LayerStack_p::createLayer(QQmlComponent *component, QVariantMap properties, bool async,
+                                      std::function<void(QQuickItem *)> onReady, bool isPush)
+{
+    QQmlContext *context = component->creationContext();
+    if (!context)
+        context = qmlContext(this);
+
+    properties.insert("width", width());
+    properties.insert("height", height());
+    properties.insert("clip", true);
+
+    if (!async) {
+        QQuickItem *item = adopt(component->createWithInitialProperties(properties, context));
+        if (item)
+            onReady(item);
+        return item;
+    }
+
+    auto *incubator = new LayerIncubator([this, onReady](LayerIncubator *incubator, QObject *object) {
+        if (m_pendingPush == incubator)
+            m_pendingPush = nullptr;
+        if (object) {
+            incubator->item = adopt(object);
+            if (incubator->item)
+                onReady(incubator->item);
+        }
+        // The incubator can't be deleted from its own statusChanged().
+        QMetaObject::invokeMethod(this, [this, incubator]() {
+            m_incubators.removeOne(incubator);
+            delete incubator;
+        }, Qt::QueuedConnection);
+    });
+    m_incubators.append(incubator);
+
+    incubator->setInitialProperties(properties);
+    component->create(*incubator, context);
+
+    if (!incubator->isLoading())
+        return incubator->item;
+    if (isPush)
+        m_pendingPush = incubator;
+    return nullptr;
+}
+
+QQuickItem *LayerStack_p::adopt(QObject *object)
+{
+    QQuickItem *item = qobject_cast<QQuickItem *>(object);
+    if (!item) {
+        qWarning("LayerStack: layers must be Items");
+        delete object;
+        return nullptr;
+    }
+
+    QQmlEngine::setObjectOwnership(item, QQmlEngine::CppOwnership);
+    item->setParent(this);
+    item->setSize(size());
+    return item;
+}
+
+QQuickItem *LayerStack_p::takeCached(QQmlComponent *component)
+{
+    for (QList<Layer> *list : { &m_preloaded, &m_cache }) {
+        for (int i = list->size() - 1; i >= 0; --i) {
+            if (list->at(i).component == component && list->at(i).item)
+                return list->takeAt(i).item;
+        }
+    }
+    return nullptr;
+}
+
+void LayerStack_p::showLayer(QQuickItem *item, QQmlComponent *component)
+{
+    m_layers.append({ item, component });
+    item->setParentItem(this);
+    updateLayers();
+    emit layersChanged();
+    emit layerPushed(item);
+    trim();
+}
+
+void LayerStack_p::destroyLayer(QQuickItem *item)
+{
+    if (!item)
+        return;
+    item->setVisible(false);
+    item->setParentItem(nullptr);
+    item->deleteLater();
+}
+
+void LayerStack_p::updateLayers()
+{
+    const int top = m_layers.size();
+    auto place = [this, top](QQuickItem *item, int index) {
+        item->setPosition(QPointF(index * width(), 0));
+        item->setSize(size());
+        item->setVisible(index == top || (m_transitioning && index == top - 1));
+    };
+
+    if (m_firstPageItem)
+        place(m_firstPageItem, 0);
+    for (int i = 0; i < m_layers.size(); ++i) {
+        if (m_layers.at(i).item)
+            place(m_layers.at(i).item, i + 1);
+    }
+}
+
+// Once the stack gets deep, memory is better spent on the pages in use than on
+// pages that might be opened again.
+void LayerStack_p::trim()
+{
+    if (m_trimDepth <= 0 || m_layers.size() != m_trimDepth)
+        return;
+
+    clearCache();
+    if (window())
+        window()->releaseResources();
+}
+
+void LayerStack_p::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() == oldGeometry.size())
+        return;
+
+    updateLayers();
+    for (const QList<Layer> *list : { &m_preloaded, &m_cache }) {
+        for (const Layer &layer : *list) {
+            if (layer.item)
+                layer.item->setSize(size());
+        }
+    }
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef LAYERSTACK_P_H
+#define LAYERSTACK_P_H
+
+#include <QQuickItem>
+#include <QQmlComponent>
+#include <QQmlListProperty>
+#include <QJSValue>
+#include <QPointer>
+#include <QList>
+#include <QtQml/qqmlregistration.h>
+#include <functional>
+
+class LayerIncubator;
+
+/*
+ * Page bookkeeping behind LayerStack.qml.
+ *
+ * Layers are laid out side by side, layer n at x = n * width, and the QML side
+ * scrolls this item with XAnimators. Only the current layer is visible, plus
+ * the one below it while a transition is running, so pages that are off-screen
+ * do not take part in rendering. Popped layers can be kept in a cache and
+ * pages can be incubated ahead of time; both are detached from the item tree.
+ */
+class LayerStack_p : public QQuickItem
+{
+    Q_OBJECT
+    QML_NAMED_ELEMENT(LayerStack_p)
+    Q_PROPERTY(QQmlComponent *firstPage READ firstPage WRITE setFirstPage NOTIFY firstPageChanged)
+    Q_PROPERTY(QQuickItem *firstPageItem READ firstPageItem NOTIFY firstPageItemChanged)
+    Q_PROPERTY(QQmlListProperty<QQuickItem> layers READ layers NOTIFY layersChanged)
+    Q_PROPERTY(QQuickItem *currentLayer READ currentLayer NOTIFY layersChanged)
+    Q_PROPERTY(int depth READ depth NOTIFY layersChanged)
+    Q_PROPERTY(bool asynchronous READ asynchronous WRITE setAsynchronous NOTIFY asynchronousChanged)
+    Q_PROPERTY(int cacheSize READ cacheSize WRITE setCacheSize NOTIFY cacheSizeChanged)
+    Q_PROPERTY(int trimDepth READ trimDepth WRITE setTrimDepth NOTIFY trimDepthChanged)
+    Q_PROPERTY(bool transitioning READ transitioning WRITE setTransitioning NOTIFY transitioningChanged)
+
+public:
+    explicit LayerStack_p(QQuickItem *parent = nullptr);
+    ~LayerStack_p();
+
+    QQmlComponent *firstPage() const { return m_firstPage; }
+    void setFirstPage(QQmlComponent *component);
+
+    QQuickItem *firstPageItem() const { return m_firstPageItem; }
+    QQmlListProperty<QQuickItem> layers();
+    QQuickItem *currentLayer() const;
+    int depth() const { return m_layers.size(); }
+
+    bool asynchronous() const { return m_asynchronous; }
+    void setAsynchronous(bool asynchronous);
+
+    int cacheSize() const { return m_cacheSize; }
+    void setCacheSize(int size);
+
+    int trimDepth() const { return m_trimDepth; }
+    void setTrimDepth(int depth);
+
+    bool transitioning() const { return m_transitioning; }
+    void setTransitioning(bool transitioning);
+
+    Q_INVOKABLE QQuickItem *push(QQmlComponent *component, const QJSValue &params = QJSValue());
+    Q_INVOKABLE void preload(QQmlComponent *component, const QJSValue &params = QJSValue());
+    Q_INVOKABLE void pop(QQuickItem *item);
+    Q_INVOKABLE void clearCache();
+
+signals:
+    void firstPageChanged();
+    void firstPageItemChanged();
+    void layersChanged();
+    void asynchronousChanged();
+    void cacheSizeChanged();
+    void trimDepthChanged();
+    void transitioningChanged();
+    void layerPushed(QQuickItem *item);
+    void layerPopped();
+
+protected:
+    void componentComplete() override;
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+
+private:
+    struct Layer {
+        QPointer<QQuickItem> item;
+        QPointer<QQmlComponent> component;
+    };
+
+    static qsizetype layerCount(QQmlListProperty<QQuickItem> *list);
+    static QQuickItem *layerAt(QQmlListProperty<QQuickItem> *list, qsizetype index);
+
+    void createFirstPage();
+    QQuickItem *createLayer(QQmlComponent *component, QVariantMap properties, bool async,
+                            std::function<void(QQuickItem *)> onReady, bool isPush);
+    QQuickItem *adopt(QObject *object);
+    QQuickItem *takeCached(QQmlComponent *component);
+    void showLayer(QQuickItem *item, QQmlComponent *component);
+    void destroyLayer(QQuickItem *item);
+    void updateLayers();
+    void trim();
+
+    QPointer<QQmlComponent> m_firstPage;
+    QPointer<QQuickItem> m_firstPageItem;
+    QList<Layer> m_layers;
+    QList<Layer> m_preloaded;
+    QList<Layer> m_cache;
+    QList<LayerIncubator *> m_incubators;
+    LayerIncubator *m_pendingPush;
+    bool m_asynchronous;
+    int m_cacheSize;
+    int m_trimDepth;
+    bool m_transitioning;
+};
+
+#endif // LAYERSTACK_P_H
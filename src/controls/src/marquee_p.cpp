@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "marquee_p.h"
+
+#include <QAbstractTextDocumentLayout>
+#include <QFontMetricsF>
+#include <QGuiApplication>
+#include <QPainter>
+#include <QQuickWindow>
+#include <QSGSimpleTextureNode>
+#include <QtMath>
+
+static const int TILE_WIDTH = 1024;
+
+// Values of Text.TextFormat, StyledText has no Qt::TextFormat equivalent
+enum { PlainText = 0, RichText = 1, AutoText = 2, MarkdownText = 3, StyledText = 4 };
+
+Marquee_p::Marquee_p(QQuickItem *parent) : QQuickItem(parent)
+{
+    m_color = Qt::white;
+    m_textFormat = AutoText;
+    m_tilesDirty = false;
+    setFlag(ItemHasContents, true);
+}
+
+static qreal effectiveDpr(QQuickItem *item)
+{
+    if (item->window())
+        return item->window()->effectiveDevicePixelRatio();
+    return qGuiApp ? qGuiApp->devicePixelRatio() : 1.0;
+}
+
+void Marquee_p::setText(const QString &text)
+{
+    if (m_text == text)
+        return;
+    m_text = text;
+    updateContentSize();
+    emit textChanged();
+}
+
+void Marquee_p::setFont(const QFont &font)
+{
+    if (m_font == font)
+        return;
+    m_font = font;
+    updateContentSize();
+    emit fontChanged();
+}
+
+void Marquee_p::setColor(const QColor &color)
+{
+    if (m_color == color)
+        return;
+    m_color = color;
+    polish();
+    emit colorChanged();
+}
+
+void Marquee_p::setTextFormat(int format)
+{
+    if (m_textFormat == format)
+        return;
+    m_textFormat = format;
+    updateContentSize();
+    emit textFormatChanged();
+}
+
+void Marquee_p::updateContentSize()
+{
+    const bool rich = m_textFormat == RichText || m_textFormat == StyledText
+            || m_textFormat == MarkdownText
+            || (m_textFormat == AutoText && Qt::mightBeRichText(m_text));
+
+    QSizeF size;
+    if (rich && !m_text.isEmpty()) {
+        if (!m_document)
+            m_document.reset(new QTextDocument);
+        m_document->setDocumentMargin(0);
+        m_document->setDefaultFont(m_font);
+        m_document->setTextWidth(-1);
+        if (m_textFormat == MarkdownText)
+            m_document->setMarkdown(m_text);
+        else
+            m_document->setHtml(m_text);
+        const QFontMetricsF metrics(m_font);
+        size = QSizeF(qCeil(m_document->idealWidth()),
+                      qCeil(qMax(m_document->size().height(), metrics.height())));
+    } else {
+        m_document.reset();
+        const QFontMetricsF metrics(m_font);
+        size = QSizeF(m_text.isEmpty() ? 0 : qCeil(metrics.horizontalAdvance(m_text)),
+                      qCeil(metrics.height()));
+    }
+
+    if (size != m_contentSize) {
+        m_contentSize = size;
+        setImplicitSize(size.width(), size.height());
+        emit contentSizeChanged();
+    }
+    polish();
+}
+
+// Deferred to the polish phase so that setting text, font and color in a row
+// only paints the text once.
+void Marquee_p::updatePolish()
+{
+    m_tiles.clear();
+    m_tilesDirty = true;
+
+    if (!m_text.isEmpty() && !m_contentSize.isEmpty()) {
+        const qreal dpr = effectiveDpr(this);
+        const int pixelWidth = qCeil(m_contentSize.width() * dpr);
+        const int pixelHeight = qCeil(m_contentSize.height() * dpr);
+
+        for (int left = 0; left < pixelWidth; left += TILE_WIDTH) {
+            QImage tile(qMin(TILE_WIDTH, pixelWidth - left), pixelHeight,
+                        QImage::Format_ARGB32_Premultiplied);
+            tile.fill(Qt::transparent);
+
+            QPainter painter(&tile);
+            painter.setRenderHint(QPainter::TextAntialiasing);
+            painter.scale(dpr, dpr);
+            painter.translate(-left / dpr, 0);
+            if (m_document) {
+                QAbstractTextDocumentLayout::PaintContext context;
+                context.palette.setColor(QPalette::Text, m_color);
+                m_document->documentLayout()->draw(&painter, context);
+            } else {
+                painter.setFont(m_font);
+                painter.setPen(m_color);
+                painter.drawText(QRectF(QPointF(0, 0), m_contentSize),
+                                 Qt::AlignLeft | Qt::AlignVCenter | Qt::TextSingleLine, m_text);
+            }
+            painter.end();
+
+            m_tiles.append(tile);
+        }
+    }
+
+    update();
+}
+
+void Marquee_p::itemChange(ItemChange change, const ItemChangeData &value)
+{
+    QQuickItem::itemChange(change, value);
+    if (change == ItemDevicePixelRatioHasChanged || (change == ItemSceneChange && value.window))
+        polish();
+}
+
+QSGNode *Marquee_p::updatePaintNode(QSGNode *old, UpdatePaintNodeData *)
+{
+    // Only re-upload when the rasterized text changed, moving the item around
+    // never touches the textures.
+    if (!m_tilesDirty) {
+        // The scene graph dropped our nodes along with the textures, the
+        // images were already released so paint them again.
+        if (!old && !m_text.isEmpty() && !m_contentSize.isEmpty())
+            QMetaObject::invokeMethod(this, [this]() { polish(); }, Qt::QueuedConnection);
+        return old;
+    }
+    m_tilesDirty = false;
+
+    if (m_tiles.isEmpty()) {
+        delete old;
+        return nullptr;
+    }
+
+    QSGNode *root = old;
+    if (!root)
+        root = new QSGNode;
+    while (QSGNode *child = root->firstChild()) {
+        root->removeChildNode(child);
+        delete child;
+    }
+
+    const qreal dpr = effectiveDpr(this);
+    qreal x = 0;
+    for (const QImage &tile : std::as_const(m_tiles)) {
+        auto *node = new QSGSimpleTextureNode;
+        node->setOwnsTexture(true);
+        node->setTexture(window()->createTextureFromImage(tile));
+        node->setFiltering(QSGTexture::Linear);
+        node->setRect(x, 0, tile.width() / dpr, m_contentSize.height());
+        root->appendChildNode(node);
+        x += tile.width() / dpr;
+    }
+    // The textures hold the only copy we need from now on
+    m_tiles.clear();
+
+    return root;
+}
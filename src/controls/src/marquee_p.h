@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef MARQUEE_P_H
+#define MARQUEE_P_H
+
+#include <QQuickItem>
+#include <QColor>
+#include <QFont>
+#include <QImage>
+#include <QList>
+#include <QScopedPointer>
+#include <QTextDocument>
+#include <QtQml/qqmlregistration.h>
+
+/*
+ * Single line of text rasterized once into a set of cached textures.
+ *
+ * The text is shaped and painted on the GUI thread only when text, font,
+ * color or device pixel ratio change; the scene graph then just uploads the
+ * resulting images and they are dropped. Marquee.qml moves this item with XAnimators so that
+ * scrolling is a pure transform change handled on the render thread.
+ *
+ * textFormat takes the Text.TextFormat values. Rich and styled text go
+ * through a QTextDocument, and AutoText picks it with Qt::mightBeRichText()
+ * like Text does, so markup that used to work with a Label still renders.
+ */
+class Marquee_p : public QQuickItem
+{
+    Q_OBJECT
+    QML_NAMED_ELEMENT(Marquee_p)
+    Q_PROPERTY(QString text READ text WRITE setText NOTIFY textChanged)
+    Q_PROPERTY(QFont font READ font WRITE setFont NOTIFY fontChanged)
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
+    Q_PROPERTY(int textFormat READ textFormat WRITE setTextFormat NOTIFY textFormatChanged)
+    Q_PROPERTY(qreal contentWidth READ contentWidth NOTIFY contentSizeChanged)
+    Q_PROPERTY(qreal contentHeight READ contentHeight NOTIFY contentSizeChanged)
+
+public:
+    explicit Marquee_p(QQuickItem *parent = nullptr);
+
+    QString text() const { return m_text; }
+    void setText(const QString &text);
+
+    QFont font() const { return m_font; }
+    void setFont(const QFont &font);
+
+    QColor color() const { return m_color; }
+    void setColor(const QColor &color);
+
+    int textFormat() const { return m_textFormat; }
+    void setTextFormat(int format);
+
+    qreal contentWidth() const { return m_contentSize.width(); }
+    qreal contentHeight() const { return m_contentSize.height(); }
+
+signals:
+    void textChanged();
+    void fontChanged();
+    void colorChanged();
+    void textFormatChanged();
+    void contentSizeChanged();
+
+protected:
+    QSGNode *updatePaintNode(QSGNode *node, UpdatePaintNodeData *data) override;
+    void updatePolish() override;
+    void itemChange(ItemChange change, const ItemChangeData &value) override;
+
+private:
+    void updateContentSize();
+
+    QString m_text;
+    QFont m_font;
+    QColor m_color;
+    int m_textFormat;
+    // Only set when the text is laid out as rich text
+    QScopedPointer<QTextDocument> m_document;
+    QSizeF m_contentSize;
+    // Text split in tiles no wider than the smallest max texture size we
+    // can expect on watch GPUs. Only kept until they are uploaded.
+    QList<QImage> m_tiles;
+    bool m_tilesDirty;
+};
+
+#endif // MARQUEE_P_H
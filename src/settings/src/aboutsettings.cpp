@@ -9,55 +9,16 @@
  */
 
 #include "aboutsettings.h"
+#include "systemidentity.h"
 
 #include <QFile>
-#include <QTextStream>
+#include <QFuture>
+#include <QPromise>
+#include <QThreadPool>
 #include <QDir>
+#include <memory>
 
-AboutSettings::AboutSettings(QObject *parent) : QObject(parent) {}
-
-void AboutSettings::ensureOsRelease()
-{
-    if (m_osReleaseParsed)
-        return;
-    m_osReleaseParsed = true;
-
-    QFile f("/etc/os-release");
-    if (!f.open(QIODevice::ReadOnly | QIODevice::Text))
-        return;
-
-    QTextStream in(&f);
-    while (!in.atEnd()) {
-        const QString line = in.readLine().trimmed();
-        const int eq = line.indexOf('=');
-        if (eq < 0)
-            continue;
-        const QString key = line.left(eq);
-        QString val = line.mid(eq + 1);
-        if (val.startsWith('"') && val.endsWith('"') && val.size() >= 2)
-            val = val.mid(1, val.size() - 2);
-        if (key == "NAME")
-            m_osName = val;
-        else if (key == "VERSION_ID" && m_osVersion.isEmpty())
-            m_osVersion = val;
-        else if (key == "VERSION")
-            m_osVersion = val;
-    }
-}
-
-QString AboutSettings::operatingSystemName()
-{
-    ensureOsRelease();
-    return m_osName;
-}
-
-QString AboutSettings::softwareVersion()
-{
-    ensureOsRelease();
-    return m_osVersion;
-}
-
-QString AboutSettings::wlanMacAddress()
+static QString readWlanMacAddress()
 {
     // First wireless interface's permanent address.
     const QDir net("/sys/class/net");
@@ -71,7 +32,7 @@ QString AboutSettings::wlanMacAddress()
     return QString();
 }
 
-QString AboutSettings::serial()
+static QString readSerial()
 {
     static const QStringList candidates = {
         "/config/serial/serial.txt",
@@ -85,3 +46,46 @@ QString AboutSettings::serial()
     }
     return QString();
 }
+
+// Started by the first AboutSettings, the files involved don't change while
+// the device runs.
+static QFuture<AboutSettings::Info> aboutInfo()
+{
+    static const QFuture<AboutSettings::Info> s_future = [] {
+        auto promise = std::make_shared<QPromise<AboutSettings::Info>>();
+        QFuture<AboutSettings::Info> future = promise->future();
+        promise->start();
+        QThreadPool::globalInstance()->start([promise]() {
+            AboutSettings::Info info;
+            const SystemIdentity &identity = SystemIdentity::instance();
+            info.osName = identity.osRelease("NAME");
+            info.osVersion = identity.osRelease("VERSION");
+            if (info.osVersion.isEmpty())
+                info.osVersion = identity.osRelease("VERSION_ID");
+            info.wlanMacAddress = readWlanMacAddress();
+            info.serial = readSerial();
+            promise->addResult(info);
+            promise->finish();
+        });
+        return future;
+    }();
+    return s_future;
+}
+
+AboutSettings::AboutSettings(QObject *parent) : QObject(parent)
+{
+    QFuture<Info> future = aboutInfo();
+    if (future.isFinished()) {
+        m_info = future.result();
+        m_loaded = true;
+    } else {
+        future.then(this, [this](const Info &info) { setInfo(info); });
+    }
+}
+
+void AboutSettings::setInfo(const Info &info)
+{
+    m_info = info;
+    m_loaded = true;
+    emit loadedChanged();
+}
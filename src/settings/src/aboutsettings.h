@@ -15,27 +15,44 @@
 #include <QObject>
 #include <QString>
 
+/*
+ * Read-only facts for the About page. They are read once per process on a
+ * worker thread, instances created after that get them right away. Until then
+ * the properties are empty and loadedChanged() fires once they are available.
+ */
 class AboutSettings : public QObject
 {
     Q_OBJECT
-    Q_PROPERTY(QString operatingSystemName READ operatingSystemName CONSTANT)
-    Q_PROPERTY(QString softwareVersion     READ softwareVersion     CONSTANT)
-    Q_PROPERTY(QString wlanMacAddress      READ wlanMacAddress      CONSTANT)
-    Q_PROPERTY(QString serial              READ serial              CONSTANT)
+    Q_PROPERTY(QString operatingSystemName READ operatingSystemName NOTIFY loadedChanged)
+    Q_PROPERTY(QString softwareVersion     READ softwareVersion     NOTIFY loadedChanged)
+    Q_PROPERTY(QString wlanMacAddress      READ wlanMacAddress      NOTIFY loadedChanged)
+    Q_PROPERTY(QString serial              READ serial              NOTIFY loadedChanged)
+    Q_PROPERTY(bool    loaded              READ loaded              NOTIFY loadedChanged)
 
 public:
     explicit AboutSettings(QObject *parent = nullptr);
 
-    QString operatingSystemName();
-    QString softwareVersion();
-    QString wlanMacAddress();
-    QString serial();
+    QString operatingSystemName() const { return m_info.osName; }
+    QString softwareVersion() const     { return m_info.osVersion; }
+    QString wlanMacAddress() const      { return m_info.wlanMacAddress; }
+    QString serial() const              { return m_info.serial; }
+    bool    loaded() const              { return m_loaded; }
+
+    struct Info {
+        QString osName;
+        QString osVersion;
+        QString wlanMacAddress;
+        QString serial;
+    };
+
+signals:
+    void loadedChanged();
 
 private:
-    void ensureOsRelease();
-    QString m_osName;
-    QString m_osVersion;
-    bool    m_osReleaseParsed = false;
+    void setInfo(const Info &info);
+
+    Info m_info;
+    bool m_loaded = false;
 };
 
 #endif // ABOUTSETTINGS_H
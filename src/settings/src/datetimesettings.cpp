@@ -9,23 +9,147 @@
  */
 
 #include "datetimesettings.h"
+#include "dbusproxy.h"
 
-#include <QDBusConnection>
-#include <QDBusInterface>
+#include <QDBusArgument>
+#include <QDBusMessage>
+#include <QDBusPendingCallWatcher>
+#include <QDBusVariant>
 #include <QDateTime>
+#include <QDebug>
 #include <QTimeZone>
+#include <QTimer>
 
 static const char *TD_SERVICE = "org.freedesktop.timedate1";
 static const char *TD_PATH    = "/org/freedesktop/timedate1";
 static const char *TD_IFACE   = "org.freedesktop.timedate1";
 
-DateTimeSettings::DateTimeSettings(QObject *parent) : QObject(parent) {}
+// How often NTPSynchronized is read while waiting for a sync. The interval
+// doubles after each poll up to the maximum, a watch can stay offline for days.
+static const int SYNC_POLL_MIN_INTERVAL = 10 * 1000;
+static const int SYNC_POLL_MAX_INTERVAL = 15 * 60 * 1000;
+
+static DBusProxy *timedate()
+{
+    return DBusProxy::systemBus(TD_SERVICE, TD_PATH, TD_IFACE);
+}
+
+DateTimeSettings::DateTimeSettings(QObject *parent) : QObject(parent)
+{
+    m_syncPollTimer = new QTimer(this);
+    m_syncPollTimer->setInterval(SYNC_POLL_MIN_INTERVAL);
+    connect(m_syncPollTimer, &QTimer::timeout, this, &DateTimeSettings::pollNtpSynchronized);
+
+    DBusProxy::systemBus(TD_SERVICE, TD_PATH, "org.freedesktop.DBus.Properties")->connect(
+        "PropertiesChanged", this, SLOT(onPropertiesChanged(QString, QVariantMap, QStringList)));
+    fetchProperties();
+}
+
+void DateTimeSettings::fetchProperties()
+{
+    auto *watcher = new QDBusPendingCallWatcher(timedate()->getAllProperties(), this);
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, [this](QDBusPendingCallWatcher *w) {
+        QDBusMessage reply = w->reply();
+        w->deleteLater();
+        if (reply.type() == QDBusMessage::ReplyMessage && !reply.arguments().isEmpty())
+            updateProperties(qdbus_cast<QVariantMap>(reply.arguments().at(0)));
+    });
+}
+
+void DateTimeSettings::updateProperties(const QVariantMap &properties)
+{
+    if (properties.contains("Timezone"))
+        m_timezoneKnown = true;
+    if (properties.contains("Timezone") && m_timezone != properties.value("Timezone").toString()) {
+        m_timezone = properties.value("Timezone").toString();
+        emit timezoneChanged();
+    }
+    if (properties.contains("NTP") && m_ntp != properties.value("NTP").toBool()) {
+        m_ntp = properties.value("NTP").toBool();
+        emit ntpChanged();
+    }
+    if (properties.contains("CanNTP") && m_canNtp != properties.value("CanNTP").toBool()) {
+        m_canNtp = properties.value("CanNTP").toBool();
+        emit canNtpChanged();
+    }
+    if (properties.contains("NTPSynchronized") && m_ntpSynchronized != properties.value("NTPSynchronized").toBool()) {
+        m_ntpSynchronized = properties.value("NTPSynchronized").toBool();
+        emit ntpSynchronizedChanged();
+    }
+    if (properties.contains("LocalRTC") && m_localRtc != properties.value("LocalRTC").toBool()) {
+        m_localRtc = properties.value("LocalRTC").toBool();
+        emit localRtcChanged();
+    }
+    updateSyncPolling();
+}
+
+// timedated never signals NTPSynchronized, so it is polled while NTP is on
+// and the clock is not synchronized yet, backing off each time. Losing sync
+// later is only noticed on the next refetch.
+void DateTimeSettings::updateSyncPolling()
+{
+    if (!m_ntp || m_ntpSynchronized) {
+        m_syncPollTimer->stop();
+    } else if (!m_syncPollTimer->isActive()) {
+        m_syncPollTimer->setInterval(SYNC_POLL_MIN_INTERVAL);
+        m_syncPollTimer->start();
+    }
+}
+
+void DateTimeSettings::pollNtpSynchronized()
+{
+    m_syncPollTimer->setInterval(qMin(m_syncPollTimer->interval() * 2, SYNC_POLL_MAX_INTERVAL));
+
+    auto *watcher = new QDBusPendingCallWatcher(timedate()->getProperty("NTPSynchronized"), this);
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, [this](QDBusPendingCallWatcher *w) {
+        QDBusMessage reply = w->reply();
+        w->deleteLater();
+        if (reply.type() == QDBusMessage::ReplyMessage && !reply.arguments().isEmpty()) {
+            const QVariant value = qdbus_cast<QDBusVariant>(reply.arguments().at(0)).variant();
+            updateProperties({ { "NTPSynchronized", value } });
+        }
+    });
+}
+
+// The properties were set optimistically; on failure, e.g. a polkit denial or
+// an unknown zone, fetch the real state back.
+void DateTimeSettings::checkReply(const char *method, const QDBusMessage &reply)
+{
+    if (reply.type() == QDBusMessage::ReplyMessage)
+        return;
+    qWarning() << "DateTimeSettings:" << method << "failed:" << reply.errorMessage();
+    fetchProperties();
+}
+
+QString DateTimeSettings::currentTimezone()
+{
+    if (!m_timezoneKnown) {
+        QDBusPendingCall call = timedate()->getProperty("Timezone");
+        call.waitForFinished();
+        const QDBusMessage reply = call.reply();
+        if (reply.type() == QDBusMessage::ReplyMessage && !reply.arguments().isEmpty()) {
+            const QVariant value = qdbus_cast<QDBusVariant>(reply.arguments().at(0)).variant();
+            updateProperties({ { "Timezone", value } });
+        }
+    }
+    return m_timezone;
+}
+
+void DateTimeSettings::onPropertiesChanged(const QString &interface, const QVariantMap &changed, const QStringList &invalidated)
+{
+    if (interface != QLatin1String(TD_IFACE))
+        return;
+
+    updateProperties(changed);
+    // timedated doesn't send the value of everything it changes
+    if (!invalidated.isEmpty())
+        fetchProperties();
+}
 
 void DateTimeSettings::applyEpoch(qint64 secsSinceEpoch)
 {
-    QDBusInterface iface(TD_SERVICE, TD_PATH, TD_IFACE, QDBusConnection::systemBus());
     // SetTime(usec_utc, relative=false, interactive=false)
-    iface.asyncCall("SetTime", qint64(secsSinceEpoch * 1000000LL), false, false);
+    timedate()->asyncCall("SetTime", { qint64(secsSinceEpoch * 1000000LL), false, false });
 }
 
 void DateTimeSettings::setTime(int hour, int minute)
@@ -44,13 +168,28 @@ void DateTimeSettings::setDate(const QDate &date)
 
 void DateTimeSettings::setTimezone(const QString &timezone)
 {
-    QDBusInterface iface(TD_SERVICE, TD_PATH, TD_IFACE, QDBusConnection::systemBus());
     // SetTimezone(name, interactive=false)
-    iface.asyncCall("SetTimezone", timezone, false);
+    timedate()->call("SetTimezone", { timezone, false }, this, [this](const QDBusMessage &reply) {
+        checkReply("SetTimezone", reply);
+    });
+
+    m_timezoneKnown = true;
+    if (m_timezone != timezone) {
+        m_timezone = timezone;
+        emit timezoneChanged();
+    }
 }
 
-QString DateTimeSettings::currentTimezone() const
+void DateTimeSettings::setNtp(bool enabled)
 {
-    QDBusInterface iface(TD_SERVICE, TD_PATH, TD_IFACE, QDBusConnection::systemBus());
-    return iface.property("Timezone").toString();
+    // SetNTP(use_ntp, interactive=false)
+    timedate()->call("SetNTP", { enabled, false }, this, [this](const QDBusMessage &reply) {
+        checkReply("SetNTP", reply);
+    });
+
+    if (m_ntp != enabled) {
+        m_ntp = enabled;
+        emit ntpChanged();
+        updateSyncPolling();
+    }
 }
@@ -13,20 +13,72 @@
 
 #include <QObject>
 #include <QDate>
+#include <QStringList>
+#include <QVariantMap>
 
+class QDBusMessage;
+class QTimer;
+
+/*
+ * Front-end to systemd-timedated. Its properties are fetched asynchronously
+ * once and then follow org.freedesktop.DBus.Properties.PropertiesChanged, so
+ * reading them never blocks. They hold defaults until the first reply.
+ * timezone and ntp change as soon as they are set, and are fetched again if
+ * timedated refuses the change.
+ */
 class DateTimeSettings : public QObject
 {
     Q_OBJECT
+    Q_PROPERTY(QString timezone READ timezone WRITE setTimezone NOTIFY timezoneChanged)
+    Q_PROPERTY(bool ntp READ ntp WRITE setNtp NOTIFY ntpChanged)
+    Q_PROPERTY(bool canNtp READ canNtp NOTIFY canNtpChanged)
+    // Polled while waiting for a sync, less and less often, timedated never
+    // signals it
+    Q_PROPERTY(bool ntpSynchronized READ ntpSynchronized NOTIFY ntpSynchronizedChanged)
+    Q_PROPERTY(bool localRtc READ localRtc NOTIFY localRtcChanged)
+
 public:
     explicit DateTimeSettings(QObject *parent = nullptr);
 
+    QString timezone() const { return m_timezone; }
+    bool ntp() const { return m_ntp; }
+    void setNtp(bool enabled);
+    bool canNtp() const { return m_canNtp; }
+    bool ntpSynchronized() const { return m_ntpSynchronized; }
+    bool localRtc() const { return m_localRtc; }
+
     Q_INVOKABLE void setTime(int hour, int minute);
     Q_INVOKABLE void setDate(const QDate &date);
     Q_INVOKABLE void setTimezone(const QString &timezone);
-    Q_INVOKABLE QString currentTimezone() const;
+    // Same as the timezone property, kept for existing callers. Before the
+    // first reply from timedated it still asks it synchronously.
+    Q_INVOKABLE QString currentTimezone();
+
+signals:
+    void timezoneChanged();
+    void ntpChanged();
+    void canNtpChanged();
+    void ntpSynchronizedChanged();
+    void localRtcChanged();
+
+private slots:
+    void onPropertiesChanged(const QString &interface, const QVariantMap &changed, const QStringList &invalidated);
 
 private:
     void applyEpoch(qint64 secsSinceEpoch);
+    void fetchProperties();
+    void updateProperties(const QVariantMap &properties);
+    void updateSyncPolling();
+    void pollNtpSynchronized();
+    void checkReply(const char *method, const QDBusMessage &reply);
+
+    QTimer *m_syncPollTimer;
+    QString m_timezone;
+    bool m_timezoneKnown = false;
+    bool m_ntp = false;
+    bool m_canNtp = false;
+    bool m_ntpSynchronized = false;
+    bool m_localRtc = false;
 };
 
 #endif // DATETIMESETTINGS_H
@@ -17,28 +17,28 @@ static const QString KeyMaxBrightness = "/system/osso/dsm/display/max_display_br
 static const QString KeyLowPowerMode  = "/system/osso/dsm/display/use_low_power_mode";
 static const QString KeyAlsEnabled    = "/system/osso/dsm/display/als_enabled";
 
-DisplaySettings::DisplaySettings(QObject *parent) : QObject(parent), m_mce(new MceConfig(this))
+DisplaySettings::DisplaySettings(QObject *parent) : QObject(parent), m_mce(MceConfig::instance())
 {
-    // Seed from MCE asynchronously (no blocking on construction).
-    m_mce->get(KeyMaxBrightness, [this](const QVariant &v) {
+    // Served from the shared cache, only the first instance waits for MCE.
+    m_mce->get(KeyMaxBrightness, this, [this](const QVariant &v) {
         if (v.isValid() && m_maximumBrightness != v.toInt()) {
             m_maximumBrightness = v.toInt();
             emit maximumBrightnessChanged();
         }
     });
-    m_mce->get(KeyBrightness, [this](const QVariant &v) {
+    m_mce->get(KeyBrightness, this, [this](const QVariant &v) {
         if (v.isValid() && m_brightness != v.toInt()) {
             m_brightness = v.toInt();
             emit brightnessChanged();
         }
     });
-    m_mce->get(KeyLowPowerMode, [this](const QVariant &v) {
+    m_mce->get(KeyLowPowerMode, this, [this](const QVariant &v) {
         if (v.isValid() && m_lowPowerModeEnabled != v.toBool()) {
             m_lowPowerModeEnabled = v.toBool();
             emit lowPowerModeEnabledChanged();
         }
     });
-    m_mce->get(KeyAlsEnabled, [this](const QVariant &v) {
+    m_mce->get(KeyAlsEnabled, this, [this](const QVariant &v) {
         if (v.isValid() && m_ambientLightSensorEnabled != v.toBool()) {
             m_ambientLightSensorEnabled = v.toBool();
             emit ambientLightSensorEnabledChanged();
@@ -59,15 +59,25 @@ DisplaySettings::DisplaySettings(QObject *parent) : QObject(parent), m_mce(new M
     });
 }
 
+DisplaySettings::~DisplaySettings()
+{
+    m_mce->flush();
+}
+
 void DisplaySettings::setBrightness(int value)
 {
     if (m_brightness == value)
         return;
     m_brightness = value;
-    m_mce->set(KeyBrightness, value);
+    m_mce->set(KeyBrightness, value, MceConfig::Coalesced);
     emit brightnessChanged();
 }
 
+void DisplaySettings::flush()
+{
+    m_mce->flush();
+}
+
 void DisplaySettings::setLowPowerModeEnabled(bool enabled)
 {
     if (m_lowPowerModeEnabled == enabled)
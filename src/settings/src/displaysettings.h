@@ -25,6 +25,7 @@ class DisplaySettings : public QObject
 
 public:
     explicit DisplaySettings(QObject *parent = nullptr);
+    ~DisplaySettings();
 
     int  brightness() const                { return m_brightness; }
     int  maximumBrightness() const         { return m_maximumBrightness; }
@@ -35,6 +36,11 @@ public:
     void setLowPowerModeEnabled(bool enabled);
     void setAmbientLightSensorEnabled(bool enabled);
 
+    // Brightness writes are coalesced while it changes continuously, call this
+    // when the user lets go of the control to write the final value now. Also
+    // done when the object is destroyed.
+    Q_INVOKABLE void flush();
+
 signals:
     void brightnessChanged();
     void maximumBrightnessChanged();
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 - Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ */
+
+#include "filteredlistmodel.h"
+
+#include <algorithm>
+#include <numeric>
+
+FilteredListModel::FilteredListModel(QObject *parent) : QAbstractListModel(parent)
+{
+}
+
+int FilteredListModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+void FilteredListModel::resetRows(int size)
+{
+    m_rows.resize(size);
+    std::iota(m_rows.begin(), m_rows.end(), 0);
+}
+
+// Both lists are ascending, so going from one to the other is a series of
+// contiguous removals followed by contiguous insertions.
+void FilteredListModel::applyRows(const QList<int> &rows)
+{
+    const int oldCount = m_rows.size();
+
+    for (int row = m_rows.size() - 1; row >= 0;) {
+        if (std::binary_search(rows.cbegin(), rows.cend(), m_rows.at(row))) {
+            --row;
+            continue;
+        }
+        int first = row;
+        while (first > 0 && !std::binary_search(rows.cbegin(), rows.cend(), m_rows.at(first - 1)))
+            --first;
+        beginRemoveRows(QModelIndex(), first, row);
+        m_rows.remove(first, row - first + 1);
+        endRemoveRows();
+        row = first - 1;
+    }
+
+    for (int row = 0; row < rows.size();) {
+        if (row < m_rows.size() && m_rows.at(row) == rows.at(row)) {
+            ++row;
+            continue;
+        }
+        int last = row;
+        while (last + 1 < rows.size() && (row >= m_rows.size() || rows.at(last + 1) != m_rows.at(row)))
+            ++last;
+        beginInsertRows(QModelIndex(), row, last);
+        for (int i = row; i <= last; ++i)
+            m_rows.insert(i, rows.at(i));
+        endInsertRows();
+        row = last + 1;
+    }
+
+    if (m_rows.size() != oldCount)
+        emit countChanged();
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2026 - Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ */
+
+#ifndef FILTEREDLISTMODEL_H
+#define FILTEREDLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QList>
+
+/*
+ * Base for list models showing a filtered subset of a fixed, ordered list of
+ * entries. Subclasses compute which entries to show and applyRows() moves the
+ * model there with contiguous row removals and insertions, never a reset, so
+ * that views keep their delegates.
+ */
+class FilteredListModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
+
+public:
+    explicit FilteredListModel(QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+signals:
+    void countChanged();
+
+protected:
+    // rows are entry indices in ascending order
+    void applyRows(const QList<int> &rows);
+    // Shows every entry of a list of the given size, without emitting
+    void resetRows(int size);
+
+    QList<int> m_rows;
+};
+
+#endif // FILTEREDLISTMODEL_H
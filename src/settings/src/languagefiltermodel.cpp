@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 - Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ */
+
+#include "languagefiltermodel.h"
+
+#include <QCollator>
+#include <algorithm>
+#include <numeric>
+
+LanguageFilterModel::LanguageFilterModel(QObject *parent) : FilteredListModel(parent)
+{
+}
+
+void LanguageFilterModel::setSourceModel(LanguageModel *source)
+{
+    if (m_source == source)
+        return;
+    if (m_source)
+        disconnect(m_source, nullptr, this, nullptr);
+
+    m_source = source;
+    if (m_source)
+        connect(m_source, &QAbstractItemModel::modelReset, this, &LanguageFilterModel::rebuild);
+    rebuild();
+    emit sourceModelChanged();
+}
+
+void LanguageFilterModel::setFilter(const QString &filter)
+{
+    if (m_filter == filter)
+        return;
+    const bool narrowing = filter.contains(m_filter, Qt::CaseInsensitive);
+    m_filter = filter;
+    refilter(narrowing);
+    emit filterChanged();
+}
+
+void LanguageFilterModel::setRegion(const QString &region)
+{
+    if (m_region == region)
+        return;
+    const bool narrowing = m_region.isEmpty();
+    m_region = region;
+    refilter(narrowing);
+    emit regionChanged();
+}
+
+void LanguageFilterModel::setGroupByRegion(bool group)
+{
+    if (m_groupByRegion == group)
+        return;
+    m_groupByRegion = group;
+    rebuild();
+    emit groupByRegionChanged();
+}
+
+void LanguageFilterModel::rebuild()
+{
+    const int oldCount = m_rows.size();
+    beginResetModel();
+
+    m_entries.clear();
+    m_regionKeys.clear();
+    m_order.clear();
+    if (m_source) {
+        QCollator collator;
+        collator.setCaseSensitivity(Qt::CaseInsensitive);
+        // Languages of a region share its label, so it is decoded once
+        QHash<QString, int> regionKeys;
+
+        const int count = m_source->rowCount();
+        m_entries.reserve(count);
+        for (int row = 0; row < count; ++row) {
+            const QModelIndex index = m_source->index(row);
+            const QString name = index.data(LanguageModel::NameRole).toString();
+            const QString locale = index.data(LanguageModel::LocaleRole).toString();
+            const QString region = index.data(LanguageModel::RegionRole).toString();
+
+            int regionKey = -1;
+            if (m_groupByRegion) {
+                auto known = regionKeys.constFind(region);
+                if (known != regionKeys.cend()) {
+                    regionKey = *known;
+                } else {
+                    const QString label = index.data(LanguageModel::RegionLabelRole).toString();
+                    regionKey = int(m_regionKeys.size());
+                    m_regionKeys.push_back(collator.sortKey(label.isEmpty() ? region : label));
+                    regionKeys.insert(region, regionKey);
+                }
+            }
+
+            m_entries.push_back({ row, region, regionKey,
+                                  (name + QLatin1Char(' ') + locale).toCaseFolded(),
+                                  collator.sortKey(name), QString(), false });
+        }
+
+        m_order.resize(count);
+        std::iota(m_order.begin(), m_order.end(), 0);
+        std::stable_sort(m_order.begin(), m_order.end(), [this](int a, int b) {
+            const Entry &ea = m_entries[a];
+            const Entry &eb = m_entries[b];
+            if (m_groupByRegion) {
+                const int byRegion = m_regionKeys[ea.regionKey].compare(m_regionKeys[eb.regionKey]);
+                if (byRegion != 0)
+                    return byRegion < 0;
+            }
+            return ea.nameKey.compare(eb.nameKey) < 0;
+        });
+    }
+
+    const QString needle = m_filter.toCaseFolded();
+    m_rows.clear();
+    for (int rank = 0; rank < m_order.size(); ++rank) {
+        if (accepts(m_entries[m_order.at(rank)], needle))
+            m_rows.append(rank);
+    }
+
+    endResetModel();
+    if (m_rows.size() != oldCount)
+        emit countChanged();
+}
+
+bool LanguageFilterModel::accepts(const Entry &entry, const QString &needle) const
+{
+    if (!m_region.isEmpty() && entry.region != m_region)
+        return false;
+    return needle.isEmpty() || entry.haystack.contains(needle) || label(entry).contains(needle);
+}
+
+const QString &LanguageFilterModel::label(const Entry &entry) const
+{
+    if (!entry.labelDecoded && m_source) {
+        entry.label = m_source->data(m_source->index(entry.sourceRow), LanguageModel::RegionLabelRole)
+                .toString().toCaseFolded();
+        entry.labelDecoded = true;
+    }
+    return entry.label;
+}
+
+// When the new criteria can only hide more languages, only the shown ones
+// need checking again.
+void LanguageFilterModel::refilter(bool narrowing)
+{
+    const QString needle = m_filter.toCaseFolded();
+    QList<int> rows;
+
+    if (narrowing) {
+        for (int rank : std::as_const(m_rows)) {
+            if (accepts(m_entries[m_order.at(rank)], needle))
+                rows.append(rank);
+        }
+    } else {
+        for (int rank = 0; rank < m_order.size(); ++rank) {
+            if (accepts(m_entries[m_order.at(rank)], needle))
+                rows.append(rank);
+        }
+    }
+
+    applyRows(rows);
+}
+
+QVariant LanguageFilterModel::data(const QModelIndex &index, int role) const
+{
+    if (!m_source || !index.isValid() || index.row() < 0 || index.row() >= m_rows.size())
+        return QVariant();
+
+    const int sourceRow = m_entries[m_order.at(m_rows.at(index.row()))].sourceRow;
+    if (role == SourceIndexRole)
+        return sourceRow;
+    return m_source->data(m_source->index(sourceRow), role);
+}
+
+QHash<int, QByteArray> LanguageFilterModel::roleNames() const
+{
+    return {
+        { LanguageModel::NameRole,        "name" },
+        { LanguageModel::LocaleRole,      "locale" },
+        { LanguageModel::RegionRole,      "region" },
+        { LanguageModel::RegionLabelRole, "regionLabel" },
+        { SourceIndexRole,                "sourceIndex" },
+    };
+}
+
+int LanguageFilterModel::sourceIndex(int row) const
+{
+    if (row < 0 || row >= m_rows.size())
+        return -1;
+    return m_entries[m_order.at(m_rows.at(row))].sourceRow;
+}
+
+int LanguageFilterModel::mapFromSource(int sourceIndex) const
+{
+    for (int row = 0; row < m_rows.size(); ++row) {
+        if (m_entries[m_order.at(m_rows.at(row))].sourceRow == sourceIndex)
+            return row;
+    }
+    return -1;
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 - Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ */
+
+#ifndef LANGUAGEFILTERMODEL_H
+#define LANGUAGEFILTERMODEL_H
+
+#include "filteredlistmodel.h"
+#include "languagemodel.h"
+
+#include <QCollatorSortKey>
+#include <QPointer>
+#include <QString>
+#include <vector>
+
+/*
+ * Sorted, searchable view over a LanguageModel.
+ *
+ * filter matches the name, locale or region label of a language. region
+ * restricts the view to one region, and groupByRegion orders by region first
+ * for ListView sections. Changes of filter and region are applied
+ * incrementally; changing the order resets the model.
+ *
+ * Collation keys and search strings are computed once per language when the
+ * source is set, so sorting never calls localeAwareCompare and filtering only
+ * compares strings. Region labels are left to LanguageModel's lazy decoding.
+ * One label per region is read when grouping. A language's own label is only
+ * read when a filter doesn't already match its name or locale.
+ */
+class LanguageFilterModel : public FilteredListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(LanguageModel *sourceModel READ sourceModel WRITE setSourceModel NOTIFY sourceModelChanged)
+    Q_PROPERTY(QString filter READ filter WRITE setFilter NOTIFY filterChanged)
+    Q_PROPERTY(QString region READ region WRITE setRegion NOTIFY regionChanged)
+    Q_PROPERTY(bool groupByRegion READ groupByRegion WRITE setGroupByRegion NOTIFY groupByRegionChanged)
+
+public:
+    enum Roles { SourceIndexRole = Qt::UserRole + 100 };
+    Q_ENUM(Roles)
+
+    explicit LanguageFilterModel(QObject *parent = nullptr);
+
+    QVariant data(const QModelIndex &index, int role) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    LanguageModel *sourceModel() const { return m_source; }
+    void setSourceModel(LanguageModel *source);
+
+    QString filter() const { return m_filter; }
+    void setFilter(const QString &filter);
+
+    QString region() const { return m_region; }
+    void setRegion(const QString &region);
+
+    bool groupByRegion() const { return m_groupByRegion; }
+    void setGroupByRegion(bool group);
+
+    // Row of the source model shown at row, and the reverse (-1 if hidden)
+    Q_INVOKABLE int sourceIndex(int row) const;
+    Q_INVOKABLE int mapFromSource(int sourceIndex) const;
+
+signals:
+    void sourceModelChanged();
+    void filterChanged();
+    void regionChanged();
+    void groupByRegionChanged();
+
+private:
+    struct Entry {
+        int sourceRow;
+        QString region;
+        // Index in m_regionKeys, only set while grouping by region
+        int regionKey;
+        // Case folded name and locale
+        QString haystack;
+        QCollatorSortKey nameKey;
+        // Case folded region label, decoded on demand
+        mutable QString label;
+        mutable bool labelDecoded;
+    };
+
+    void rebuild();
+    bool accepts(const Entry &entry, const QString &needle) const;
+    const QString &label(const Entry &entry) const;
+    void refilter(bool narrowing);
+
+    QPointer<LanguageModel> m_source;
+    QString m_filter;
+    QString m_region;
+    bool m_groupByRegion = false;
+    std::vector<Entry> m_entries;
+    std::vector<QCollatorSortKey> m_regionKeys;
+    // Entry indices in display order, m_rows indexes into it
+    QList<int> m_order;
+};
+
+#endif // LANGUAGEFILTERMODEL_H
@@ -9,24 +9,172 @@
  */
 
 #include "languagemodel.h"
+#include "dbusproxy.h"
 
+#include <QDateTime>
 #include <QDir>
 #include <QFile>
 #include <QFileInfoList>
+#include <QLocale>
+#include <QSaveFile>
 #include <QSettings>
-#include <QDBusConnection>
-#include <QDBusInterface>
+#include <QStandardPaths>
 #include <algorithm>
 
 static const char *LanguageSupportDirectory = "/usr/share/supported-languages";
 
+// Binary index of LanguageSupportDirectory: a CacheHeader, one CacheRecord
+// per language in display order, then a pool of UTF-16 strings that records
+// point into. Everything is native endian, it never leaves the device.
+static const quint32 CacheMagic = 0x474e4c41; // "ALNG"
+static const quint32 CacheVersion = 1;
+
+struct CacheHeader {
+    quint32 magic;
+    quint32 version;
+    qint64 mtime;
+    quint32 count;
+    quint32 poolLength;
+    quint32 localeOffset;
+    quint32 localeLength;
+};
+
+struct CacheString {
+    quint32 offset;
+    quint32 length;
+};
+
+struct CacheRecord {
+    CacheString name;
+    CacheString localeCode;
+    CacheString region;
+    CacheString regionLabel;
+};
+
+static QString cacheFilePath()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation)
+           + "/asteroid/supported-languages.cache";
+}
+
 LanguageModel::LanguageModel(QObject *parent) : QAbstractListModel(parent)
 {
     m_languages = loadSupportedLanguages();
+    buildLocaleIndex();
     readCurrentLocale();
 }
 
-QList<Language> LanguageModel::loadSupportedLanguages() const
+LanguageModel::~LanguageModel() = default;
+
+// The sort order depends on the locale, so it is part of the cache key along
+// with the directory mtime.
+QList<Language> LanguageModel::loadSupportedLanguages()
+{
+    const qint64 mtime = QFileInfo(LanguageSupportDirectory).lastModified().toMSecsSinceEpoch();
+    const QString sortLocale = QLocale().name();
+
+    QList<Language> languages;
+    if (loadCache(mtime, sortLocale, &languages))
+        return languages;
+
+    languages = parseSupportedLanguages();
+    if (!languages.isEmpty())
+        writeCache(languages, mtime, sortLocale);
+    return languages;
+}
+
+bool LanguageModel::loadCache(qint64 mtime, const QString &sortLocale, QList<Language> *languages)
+{
+    QScopedPointer<QFile> file(new QFile(cacheFilePath()));
+    if (!file->open(QIODevice::ReadOnly) || file->size() < qint64(sizeof(CacheHeader)))
+        return false;
+
+    const qint64 size = file->size();
+    const uchar *data = file->map(0, size);
+    if (!data)
+        return false;
+
+    const CacheHeader *header = reinterpret_cast<const CacheHeader *>(data);
+    const qint64 poolStart = sizeof(CacheHeader) + qint64(header->count) * sizeof(CacheRecord);
+    if (header->magic != CacheMagic || header->version != CacheVersion || header->mtime != mtime
+            || poolStart + qint64(header->poolLength) * 2 != size)
+        return false;
+
+    const QChar *pool = reinterpret_cast<const QChar *>(data + poolStart);
+    auto valid = [header](quint32 offset, quint32 length) {
+        return offset <= header->poolLength && length <= header->poolLength - offset;
+    };
+    if (!valid(header->localeOffset, header->localeLength)
+            || QStringView(pool + header->localeOffset, header->localeLength) != sortLocale)
+        return false;
+
+    const CacheRecord *records = reinterpret_cast<const CacheRecord *>(data + sizeof(CacheHeader));
+    languages->reserve(header->count);
+    for (quint32 i = 0; i < header->count; ++i) {
+        const CacheRecord &r = records[i];
+        for (const CacheString &string : { r.name, r.localeCode, r.region, r.regionLabel }) {
+            if (!valid(string.offset, string.length)) {
+                languages->clear();
+                return false;
+            }
+        }
+
+        Language l;
+        l.name              = QString(pool + r.name.offset, r.name.length);
+        l.localeCode        = QString(pool + r.localeCode.offset, r.localeCode.length);
+        l.region            = QString(pool + r.region.offset, r.region.length);
+        l.regionLabelOffset = poolStart + qint64(r.regionLabel.offset) * 2;
+        l.regionLabelLength = r.regionLabel.length;
+        languages->append(l);
+    }
+
+    m_cache.reset(file.take());
+    m_cacheData = data;
+    return true;
+}
+
+void LanguageModel::writeCache(const QList<Language> &languages, qint64 mtime, const QString &sortLocale) const
+{
+    QString pool;
+    auto add = [&pool](const QString &string) {
+        const CacheString entry = { quint32(pool.size()), quint32(string.size()) };
+        pool += string;
+        return entry;
+    };
+
+    CacheHeader header = { CacheMagic, CacheVersion, mtime, quint32(languages.size()), 0, 0, 0 };
+    const CacheString locale = add(sortLocale);
+    header.localeOffset = locale.offset;
+    header.localeLength = locale.length;
+
+    QList<CacheRecord> records;
+    records.reserve(languages.size());
+    for (const Language &l : languages)
+        records.append({ add(l.name), add(l.localeCode), add(l.region), add(l.regionLabel) });
+    header.poolLength = pool.size();
+
+    const QString path = cacheFilePath();
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    // Written aside and renamed, so models still mapping the old file are fine.
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly))
+        return;
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(records.constData()), records.size() * sizeof(CacheRecord));
+    file.write(reinterpret_cast<const char *>(pool.constData()), pool.size() * 2);
+    file.commit();
+}
+
+QString LanguageModel::regionLabel(int index) const
+{
+    const Language &l = m_languages.at(index);
+    if (l.regionLabelOffset < 0 || !m_cacheData)
+        return l.regionLabel;
+    return QString(reinterpret_cast<const QChar *>(m_cacheData + l.regionLabelOffset), l.regionLabelLength);
+}
+
+QList<Language> LanguageModel::parseSupportedLanguages() const
 {
     QList<Language> languages;
     const QFileInfoList files = QDir(LanguageSupportDirectory)
@@ -68,32 +216,47 @@ static QString localeBase(const QString &code)
     return s.toLower();
 }
 
-// Language part only: "en_gb" -> "en".
-static QString langPart(const QString &code)
+// Language part only, of an already normalized base: "en_gb" -> "en".
+static QString langPart(const QString &base)
 {
-    const QString b = localeBase(code);
-    const int us = b.indexOf('_');
-    return us >= 0 ? b.left(us) : b;
+    const int us = base.indexOf('_');
+    return us >= 0 ? base.left(us) : base;
+}
+
+// Keys are normalized once per entry at load time. When several entries share
+// a key, the first one in display order wins.
+void LanguageModel::buildLocaleIndex()
+{
+    m_indexByBase.clear();
+    m_indexByLanguage.clear();
+    m_indexByBase.reserve(m_languages.size());
+    m_indexByLanguage.reserve(m_languages.size());
+
+    for (int i = 0; i < m_languages.size(); ++i) {
+        const QString base = localeBase(m_languages.at(i).localeCode);
+        const QString lang = langPart(base);
+        if (!m_indexByBase.contains(base))
+            m_indexByBase.insert(base, i);
+        if (!m_indexByLanguage.contains(lang))
+            m_indexByLanguage.insert(lang, i);
+    }
 }
 
 int LanguageModel::indexForLocale(const QString &localeCode) const
 {
     const QString wantBase = localeBase(localeCode);
-    const QString wantLang = langPart(localeCode);
+    const QString wantLang = langPart(wantBase);
 
     // 1. exact (normalized) match on the full base, e.g. en_gb == en_gb
-    for (int i = 0; i < m_languages.size(); ++i)
-        if (localeBase(m_languages.at(i).localeCode) == wantBase)
-            return i;
+    auto it = m_indexByBase.constFind(wantBase);
+    if (it != m_indexByBase.cend())
+        return *it;
     // 2. language-only entry with no region, e.g. "fr.utf8" for "fr"
-    for (int i = 0; i < m_languages.size(); ++i)
-        if (localeBase(m_languages.at(i).localeCode) == wantLang)
-            return i;
+    it = m_indexByBase.constFind(wantLang);
+    if (it != m_indexByBase.cend())
+        return *it;
     // 3. any entry sharing the language, e.g. "en" -> "en_GB.utf8"
-    for (int i = 0; i < m_languages.size(); ++i)
-        if (langPart(m_languages.at(i).localeCode) == wantLang)
-            return i;
-    return -1;
+    return m_indexByLanguage.value(wantLang, -1);
 }
 
 int LanguageModel::rowCount(const QModelIndex &parent) const
@@ -110,7 +273,7 @@ QVariant LanguageModel::data(const QModelIndex &index, int role) const
     case NameRole:        return l.name;
     case LocaleRole:      return l.localeCode;
     case RegionRole:      return l.region;
-    case RegionLabelRole: return l.regionLabel;
+    case RegionLabelRole: return regionLabel(index.row());
     default:              return QVariant();
     }
 }
@@ -138,9 +301,8 @@ QString LanguageModel::locale(int index) const
 void LanguageModel::setSystemLocale(const QString &localeCode, LocaleUpdateMode updateMode)
 {
     // Apply persistently via systemd-localed (writes /etc/locale.conf).
-    QDBusInterface localed("org.freedesktop.locale1", "/org/freedesktop/locale1",
-                           "org.freedesktop.locale1", QDBusConnection::systemBus());
-    localed.asyncCall("SetLocale", QStringList{ "LANG=" + localeCode }, false /* interactive */);
+    DBusProxy::systemBus("org.freedesktop.locale1", "/org/freedesktop/locale1", "org.freedesktop.locale1")
+        ->asyncCall("SetLocale", { QStringList{ "LANG=" + localeCode }, false /* interactive */ });
 
     const int oldIndex = m_currentIndex;
     m_currentIndex = indexForLocale(localeCode);
@@ -148,12 +310,10 @@ void LanguageModel::setSystemLocale(const QString &localeCode, LocaleUpdateMode
         emit currentIndexChanged();
 
     if (updateMode == UpdateAndReboot) {
-        QDBusInterface login1("org.freedesktop.login1", "/org/freedesktop/login1",
-                              "org.freedesktop.login1.Manager", QDBusConnection::systemBus());
-        login1.asyncCall("Reboot", false);
+        DBusProxy::systemBus("org.freedesktop.login1", "/org/freedesktop/login1", "org.freedesktop.login1.Manager")
+            ->asyncCall("Reboot", { false });
     } else {
-        QDBusInterface lipstick("org.nemomobile.lipstick", "/org/nemomobile/lipstick/localemanager",
-                               "org.nemomobile.lipstick", QDBusConnection::systemBus());
-        lipstick.asyncCall("selectLocale", localeCode);
+        DBusProxy::systemBus("org.nemomobile.lipstick", "/org/nemomobile/lipstick/localemanager", "org.nemomobile.lipstick")
+            ->asyncCall("selectLocale", { localeCode });
     }
 }
@@ -14,12 +14,19 @@
 #include <QAbstractListModel>
 #include <QString>
 #include <QList>
+#include <QHash>
+#include <QScopedPointer>
+
+class QFile;
 
 struct Language {
     QString name;
     QString localeCode;
     QString region;
     QString regionLabel;
+    // Byte offset of regionLabel in the mapped cache, decoded on demand
+    qint32 regionLabelOffset = -1;
+    qint32 regionLabelLength = 0;
 };
 
 class LanguageModel : public QAbstractListModel
@@ -35,6 +42,7 @@ public:
     Q_ENUM(LocaleUpdateMode)
 
     explicit LanguageModel(QObject *parent = nullptr);
+    ~LanguageModel();
 
     int rowCount(const QModelIndex &parent = QModelIndex()) const override;
     QVariant data(const QModelIndex &index, int role) const override;
@@ -50,11 +58,22 @@ signals:
     void currentIndexChanged();
 
 private:
-    QList<Language> loadSupportedLanguages() const;
+    QList<Language> loadSupportedLanguages();
+    QList<Language> parseSupportedLanguages() const;
+    bool loadCache(qint64 mtime, const QString &sortLocale, QList<Language> *languages);
+    void writeCache(const QList<Language> &languages, qint64 mtime, const QString &sortLocale) const;
+    QString regionLabel(int index) const;
     void readCurrentLocale();
     int indexForLocale(const QString &localeCode) const;
+    void buildLocaleIndex();
 
     QList<Language> m_languages;
+    // Normalized locale base ("en_gb") and language ("en") -> first row
+    QHash<QString, int> m_indexByBase;
+    QHash<QString, int> m_indexByLanguage;
+    // Memory-mapped binary index of the supported languages, see loadCache()
+    QScopedPointer<QFile> m_cache;
+    const uchar *m_cacheData = nullptr;
     int m_currentIndex = -1;
 };
 
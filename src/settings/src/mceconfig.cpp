@@ -8,14 +8,15 @@
  */
 
 #include "mceconfig.h"
+#include "dbusproxy.h"
 
-#include <QDBusConnection>
-#include <QDBusInterface>
-#include <QDBusPendingCall>
-#include <QDBusPendingCallWatcher>
-#include <QDBusPendingReply>
+#include <QCoreApplication>
+#include <QDBusArgument>
+#include <QDBusMessage>
 #include <QDBusObjectPath>
 #include <QDBusVariant>
+#include <QTimer>
+#include <utility>
 
 static const char *MCE_SERVICE      = "com.nokia.mce";
 static const char *MCE_REQUEST_PATH = "/com/nokia/mce/request";
@@ -23,36 +24,189 @@ static const char *MCE_REQUEST_IF   = "com.nokia.mce.request";
 static const char *MCE_SIGNAL_PATH  = "/com/nokia/mce/signal";
 static const char *MCE_SIGNAL_IF    = "com.nokia.mce.signal";
 
-MceConfig::MceConfig(QObject *parent) : QObject(parent)
+static DBusProxy *mceRequest()
 {
-    QDBusConnection::systemBus().connect(
-        MCE_SERVICE, MCE_SIGNAL_PATH, MCE_SIGNAL_IF, "config_change_ind",
-        this, SLOT(onConfigChangeInd(QDBusObjectPath, QDBusVariant)));
+    return DBusProxy::systemBus(MCE_SERVICE, MCE_REQUEST_PATH, MCE_REQUEST_IF);
 }
 
-void MceConfig::get(const QString &key, std::function<void(const QVariant &)> cb)
+MceConfig *MceConfig::instance()
 {
-    QDBusInterface iface(MCE_SERVICE, MCE_REQUEST_PATH, MCE_REQUEST_IF,
-                         QDBusConnection::systemBus());
-    QDBusPendingCall call = iface.asyncCall("get_config", QVariant::fromValue(QDBusObjectPath(key)));
-    auto *watcher = new QDBusPendingCallWatcher(call, this);
-    connect(watcher, &QDBusPendingCallWatcher::finished, this,
-            [cb](QDBusPendingCallWatcher *w) {
-        QDBusPendingReply<QDBusVariant> reply = *w;
-        w->deleteLater();
-        cb(reply.isError() ? QVariant() : reply.value().variant());
+    static MceConfig *s_instance = [] {
+        auto *config = new MceConfig;
+        if (QCoreApplication::instance())
+            config->moveToThread(QCoreApplication::instance()->thread());
+        return config;
+    }();
+    return s_instance;
+}
+
+MceConfig::MceConfig()
+{
+    m_flushTimer = new QTimer(this);
+    m_flushTimer->setInterval(250);
+    connect(m_flushTimer, &QTimer::timeout, this, [this]() {
+        if (m_dirty.isEmpty())
+            m_flushTimer->stop();
+        else
+            flush();
+    });
+
+    // Don't lose the last value of a slider when the app quits right after.
+    if (QCoreApplication::instance())
+        connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this, &MceConfig::flush);
+
+    DBusProxy::systemBus(MCE_SERVICE, MCE_SIGNAL_PATH, MCE_SIGNAL_IF)->connect(
+        "config_change_ind", this, SLOT(onConfigChangeInd(QDBusObjectPath, QDBusVariant)));
+    seed();
+}
+
+// One round-trip for every key MCE knows about. Keys it doesn't return, or
+// all of them on an MCE without get_config_all, are then fetched one by one.
+void MceConfig::seed()
+{
+    mceRequest()->call("get_config_all", QVariantList(), this, [this](const QDBusMessage &reply) {
+        if (reply.type() == QDBusMessage::ReplyMessage && !reply.arguments().isEmpty()) {
+            const QVariantMap all = qdbus_cast<QVariantMap>(reply.arguments().at(0));
+            for (auto it = all.cbegin(); it != all.cend(); ++it) {
+                if (!m_values.contains(it.key()))
+                    m_values.insert(it.key(), it.value());
+            }
+        }
+        m_seeded = true;
+
+        const QList<PendingGet> pending = std::exchange(m_pending, {});
+        for (const PendingGet &get : pending) {
+            if (!get.context)
+                continue;
+            if (m_values.contains(get.key)) {
+                get.cb(m_values.value(get.key));
+            } else {
+                m_pending.append(get);
+                fetch(get.key);
+            }
+        }
+    });
+}
+
+void MceConfig::fetch(const QString &key)
+{
+    if (m_fetching.contains(key))
+        return;
+    m_fetching.insert(key);
+
+    mceRequest()->call("get_config", { QVariant::fromValue(QDBusObjectPath(key)) }, this,
+                       [this, key](const QDBusMessage &reply) {
+        m_fetching.remove(key);
+        QVariant value;
+        if (reply.type() == QDBusMessage::ReplyMessage && !reply.arguments().isEmpty()) {
+            value = qdbus_cast<QDBusVariant>(reply.arguments().at(0)).variant();
+            m_values.insert(key, value);
+        }
+        resolve(key, value);
+    });
+}
+
+void MceConfig::resolve(const QString &key, const QVariant &value)
+{
+    for (int i = 0; i < m_pending.size();) {
+        if (m_pending.at(i).key != key) {
+            ++i;
+            continue;
+        }
+        const PendingGet get = m_pending.takeAt(i);
+        if (get.context)
+            get.cb(value);
+    }
+}
+
+void MceConfig::get(const QString &key, QObject *context, std::function<void(const QVariant &)> cb)
+{
+    auto cached = m_values.constFind(key);
+    if (cached != m_values.cend()) {
+        cb(*cached);
+        return;
+    }
+
+    m_pending.append({ key, context, cb });
+    if (m_seeded)
+        fetch(key);
+}
+
+void MceConfig::set(const QString &key, const QVariant &value, WriteMode mode)
+{
+    // MCE's echo is ignored while the write is pending, so other readers of
+    // this key learn about it here.
+    store(key, value);
+
+    if (mode == Immediate) {
+        m_dirty.remove(key);
+        write(key, value);
+        return;
+    }
+
+    // The first value of a burst goes out right away, the following ones
+    // are folded into one write per timer tick.
+    m_dirty.insert(key, value);
+    if (!m_flushTimer->isActive()) {
+        flush();
+        m_flushTimer->start();
+    }
+}
+
+void MceConfig::flush()
+{
+    const QHash<QString, QVariant> dirty = std::exchange(m_dirty, {});
+    for (auto it = dirty.cbegin(); it != dirty.cend(); ++it)
+        write(it.key(), it.value());
+}
+
+void MceConfig::write(const QString &key, const QVariant &value)
+{
+    ++m_writing[key];
+    mceRequest()->call("set_config", { QVariant::fromValue(QDBusObjectPath(key)),
+                                       QVariant::fromValue(QDBusVariant(value)) }, this,
+                       [this, key](const QDBusMessage &) {
+        if (--m_writing[key] > 0)
+            return;
+        m_writing.remove(key);
+        if (!m_dirty.contains(key))
+            reconcile(key);
+    });
+}
+
+// Echoes are ignored while a key is being written, and MCE may have clamped or
+// refused the value, or someone else may have changed it meanwhile. Once our
+// last write is done, ask MCE what it actually kept.
+void MceConfig::reconcile(const QString &key)
+{
+    mceRequest()->call("get_config", { QVariant::fromValue(QDBusObjectPath(key)) }, this,
+                       [this, key](const QDBusMessage &reply) {
+        // A newer write reconciles again once it is done
+        if (m_dirty.contains(key) || m_writing.contains(key))
+            return;
+        if (reply.type() != QDBusMessage::ReplyMessage || reply.arguments().isEmpty())
+            return;
+        store(key, qdbus_cast<QDBusVariant>(reply.arguments().at(0)).variant());
     });
 }
 
-void MceConfig::set(const QString &key, const QVariant &value)
+void MceConfig::store(const QString &key, const QVariant &value)
 {
-    QDBusInterface iface(MCE_SERVICE, MCE_REQUEST_PATH, MCE_REQUEST_IF,
-                         QDBusConnection::systemBus());
-    iface.asyncCall("set_config", QVariant::fromValue(QDBusObjectPath(key)),
-                    QVariant::fromValue(QDBusVariant(value)));
+    auto cached = m_values.find(key);
+    if (cached != m_values.end() && *cached == value)
+        return;
+    m_values.insert(key, value);
+    emit configChanged(key, value);
 }
 
 void MceConfig::onConfigChangeInd(const QDBusObjectPath &key, const QDBusVariant &value)
 {
-    emit configChanged(key.path(), value.variant());
+    const QString path = key.path();
+
+    // While we are writing a key, MCE only echoes values we already moved
+    // past; the cache holds the latest one and reconcile() catches up after.
+    if (m_dirty.contains(path) || m_writing.contains(path))
+        return;
+
+    store(path, value.variant());
 }
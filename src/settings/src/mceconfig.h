@@ -15,33 +15,79 @@
 #include <QString>
 #include <QDBusObjectPath>
 #include <QDBusVariant>
+#include <QHash>
+#include <QList>
+#include <QPointer>
+#include <QSet>
 #include <functional>
 
+class QTimer;
+
 /*
  * Tiny helper around MCE's builtin-gconf config interface
  * (com.nokia.mce, /com/nokia/mce/request, methods get_config/set_config taking
  * the config key as an object path).
  *
- * All reads are async; callers pass a callback. A single instance also
- * subscribes to com.nokia.mce.signal config_change_ind and reports changes.
+ * A single process-wide instance keeps a key -> value cache, seeded by one
+ * get_config_all call and kept fresh by com.nokia.mce.signal config_change_ind,
+ * so only the first settings page pays for a bus round-trip.
  */
 class MceConfig : public QObject
 {
     Q_OBJECT
+    Q_DISABLE_COPY(MceConfig)
 public:
-    explicit MceConfig(QObject *parent = nullptr);
+    static MceConfig *instance();
+
+    enum WriteMode {
+        Immediate,
+        // Only the latest value is written, at most once per flush interval.
+        // Meant for sliders and other continuous inputs, MCE persists every
+        // write to disk.
+        Coalesced
+    };
 
-    // Async get; cb is invoked with the value (invalid QVariant on error).
-    void get(const QString &key, std::function<void(const QVariant &)> cb);
-    // Fire-and-forget set.
-    void set(const QString &key, const QVariant &value);
+    // cb is invoked with the value (invalid QVariant on error), right away if
+    // it is cached. It is dropped if context is destroyed first.
+    void get(const QString &key, QObject *context, std::function<void(const QVariant &)> cb);
+    // Fire-and-forget set, the cache is updated immediately and configChanged
+    // is emitted if the value changed. Once the last write of the key is done
+    // it is read back, in case MCE kept another value.
+    void set(const QString &key, const QVariant &value, WriteMode mode = Immediate);
+    // Write out coalesced values right away, e.g. when a slider is released.
+    void flush();
 
 signals:
-    // Emitted when MCE reports a config change for any key we care about.
+    // Emitted when a key changes, through set() or reported by MCE.
     void configChanged(const QString &key, const QVariant &value);
 
 private slots:
     void onConfigChangeInd(const QDBusObjectPath &key, const QDBusVariant &value);
+
+private:
+    struct PendingGet {
+        QString key;
+        QPointer<QObject> context;
+        std::function<void(const QVariant &)> cb;
+    };
+
+    MceConfig();
+    void seed();
+    void fetch(const QString &key);
+    void resolve(const QString &key, const QVariant &value);
+    void write(const QString &key, const QVariant &value);
+    void reconcile(const QString &key);
+    // Updates the cache and emits configChanged if the value differs
+    void store(const QString &key, const QVariant &value);
+
+    QHash<QString, QVariant> m_values;
+    QList<PendingGet> m_pending;
+    QSet<QString> m_fetching;
+    // Coalesced values not written yet, and writes MCE hasn't replied to
+    QHash<QString, QVariant> m_dirty;
+    QHash<QString, int> m_writing;
+    QTimer *m_flushTimer;
+    bool m_seeded = false;
 };
 
 #endif // MCECONFIG_H
@@ -13,6 +13,8 @@
 #include "datetimesettings.h"
 #include "aboutsettings.h"
 #include "languagemodel.h"
+#include "languagefiltermodel.h"
+#include "timezonemodel.h"
 
 SettingsPlugin::SettingsPlugin(QObject *parent) : QQmlExtensionPlugin(parent)
 {
@@ -26,4 +28,6 @@ void SettingsPlugin::registerTypes(const char *uri)
     qmlRegisterType<DateTimeSettings>(uri, 1, 0, "DateTimeSettings");
     qmlRegisterType<AboutSettings>(uri, 1, 0, "AboutSettings");
     qmlRegisterType<LanguageModel>(uri, 1, 0, "LanguageModel");
+    qmlRegisterType<LanguageFilterModel>(uri, 1, 0, "LanguageFilterModel");
+    qmlRegisterType<TimezoneModel>(uri, 1, 0, "TimezoneModel");
 }
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 - Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ */
+
+#include "timezonemodel.h"
+
+#include <QHash>
+#include <QLocale>
+#include <QRegularExpression>
+#include <QTimeZone>
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+struct Zone {
+    QString id;
+    QString city;
+    QString region;
+    QString name;
+    // Case folded id, city and name, what searches run against
+    QString haystack;
+};
+
+struct ZoneIndex {
+    QList<Zone> zones;
+    // Trigram -> zones containing it, ascending
+    QHash<quint64, QList<int>> trigrams;
+    // (word, zone) sorted by word, for prefix lookups
+    QList<QPair<QString, int>> words;
+};
+
+QString normalized(const QString &text)
+{
+    QString folded = text.toCaseFolded();
+    folded.replace(QLatin1Char('_'), QLatin1Char(' '));
+    return folded;
+}
+
+quint64 trigram(const QChar *c)
+{
+    return (quint64(c[0].unicode()) << 32) | (quint64(c[1].unicode()) << 16) | c[2].unicode();
+}
+
+const ZoneIndex &zoneIndex()
+{
+    static const ZoneIndex index = [] {
+        ZoneIndex index;
+        const QLocale locale;
+        const QList<QByteArray> ids = QTimeZone::availableTimeZoneIds();
+        index.zones.reserve(ids.size());
+
+        for (const QByteArray &rawId : ids) {
+            Zone zone;
+            zone.id = QString::fromLatin1(rawId);
+            const int slash = zone.id.lastIndexOf(QLatin1Char('/'));
+            zone.city = zone.id.mid(slash + 1).replace(QLatin1Char('_'), QLatin1Char(' '));
+            zone.region = slash > 0 ? zone.id.left(zone.id.indexOf(QLatin1Char('/'))) : QString();
+            zone.name = QTimeZone(rawId).displayName(QTimeZone::StandardTime, QTimeZone::LongName, locale);
+            zone.haystack = normalized(zone.id + QLatin1Char(' ') + zone.city + QLatin1Char(' ') + zone.name);
+            index.zones.append(zone);
+        }
+
+        for (int i = 0; i < index.zones.size(); ++i) {
+            const QString &haystack = index.zones.at(i).haystack;
+            for (int c = 0; c + 3 <= haystack.size(); ++c) {
+                QList<int> &zones = index.trigrams[trigram(haystack.constData() + c)];
+                if (zones.isEmpty() || zones.last() != i)
+                    zones.append(i);
+            }
+
+            const QStringList words = haystack.split(QRegularExpression("[\\s/()-]+"), Qt::SkipEmptyParts);
+            for (const QString &word : words)
+                index.words.append({ word, i });
+        }
+        std::sort(index.words.begin(), index.words.end());
+        return index;
+    }();
+    return index;
+}
+
+// Zones one of whose words starts with prefix
+QList<int> searchPrefix(const ZoneIndex &index, const QString &prefix)
+{
+    QList<int> result;
+    auto it = std::lower_bound(index.words.cbegin(), index.words.cend(), prefix,
+                               [](const QPair<QString, int> &word, const QString &prefix) {
+        return word.first < prefix;
+    });
+    for (; it != index.words.cend() && it->first.startsWith(prefix); ++it)
+        result.append(it->second);
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+// Zones containing needle. The zones to check are those sharing the rarest
+// trigram of the needle, or candidates if given and smaller.
+QList<int> searchSubstring(const ZoneIndex &index, const QString &needle, const QList<int> *candidates)
+{
+    const QList<int> *rarest = nullptr;
+    for (int c = 0; c + 3 <= needle.size(); ++c) {
+        auto it = index.trigrams.constFind(trigram(needle.constData() + c));
+        if (it == index.trigrams.cend())
+            return QList<int>();
+        if (!rarest || it->size() < rarest->size())
+            rarest = &*it;
+    }
+
+    const QList<int> &pool = (candidates && candidates->size() < rarest->size()) ? *candidates : *rarest;
+    QList<int> result;
+    for (int zone : pool) {
+        if (index.zones.at(zone).haystack.contains(needle))
+            result.append(zone);
+    }
+    return result;
+}
+
+}
+
+TimezoneModel::TimezoneModel(QObject *parent) : FilteredListModel(parent)
+{
+    resetRows(zoneIndex().zones.size());
+}
+
+QVariant TimezoneModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() < 0 || index.row() >= m_rows.size())
+        return QVariant();
+    const Zone &zone = zoneIndex().zones.at(m_rows.at(index.row()));
+    switch (role) {
+    case ZoneIdRole: return zone.id;
+    case CityRole:   return zone.city;
+    case RegionRole: return zone.region;
+    case NameRole:   return zone.name;
+    default:         return QVariant();
+    }
+}
+
+QHash<int, QByteArray> TimezoneModel::roleNames() const
+{
+    return {
+        { ZoneIdRole, "zoneId" },
+        { CityRole,   "city" },
+        { RegionRole, "region" },
+        { NameRole,   "name" },
+    };
+}
+
+QString TimezoneModel::zoneId(int row) const
+{
+    return (row < 0 || row >= m_rows.size()) ? QString() : zoneIndex().zones.at(m_rows.at(row)).id;
+}
+
+int TimezoneModel::indexOf(const QString &zoneId) const
+{
+    const ZoneIndex &index = zoneIndex();
+    for (int row = 0; row < m_rows.size(); ++row) {
+        if (index.zones.at(m_rows.at(row)).id == zoneId)
+            return row;
+    }
+    return -1;
+}
+
+void TimezoneModel::setFilter(const QString &filter)
+{
+    if (m_filter == filter)
+        return;
+
+    const QString previous = normalized(m_filter.trimmed());
+    m_filter = filter;
+    const QString needle = normalized(filter.trimmed());
+    const ZoneIndex &index = zoneIndex();
+
+    QList<int> rows;
+    if (needle.isEmpty()) {
+        rows.resize(index.zones.size());
+        std::iota(rows.begin(), rows.end(), 0);
+    } else if (needle.size() < 3) {
+        rows = searchPrefix(index, needle);
+    } else {
+        // Typing more only ever narrows the current rows down.
+        const bool refines = previous.size() >= 3 && needle.contains(previous);
+        rows = searchSubstring(index, needle, refines ? &m_rows : nullptr);
+    }
+
+    applyRows(rows);
+    emit filterChanged();
+}
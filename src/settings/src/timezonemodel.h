@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2026 - Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ */
+
+#ifndef TIMEZONEMODEL_H
+#define TIMEZONEMODEL_H
+
+#include "filteredlistmodel.h"
+
+#include <QString>
+
+/*
+ * Time zones known to QTimeZone, sorted by id, with their city, region and
+ * display name.
+ *
+ * The list and its search index are built once per process. Setting filter
+ * narrows the rows down to the zones whose id, city or name contains it (for
+ * one or two characters, whose words start with it).
+ */
+class TimezoneModel : public FilteredListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(QString filter READ filter WRITE setFilter NOTIFY filterChanged)
+
+public:
+    enum Roles { ZoneIdRole = Qt::UserRole + 1, CityRole, RegionRole, NameRole };
+    Q_ENUM(Roles)
+
+    explicit TimezoneModel(QObject *parent = nullptr);
+
+    QVariant data(const QModelIndex &index, int role) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    QString filter() const { return m_filter; }
+    void setFilter(const QString &filter);
+
+    Q_INVOKABLE QString zoneId(int row) const;
+    Q_INVOKABLE int indexOf(const QString &zoneId) const;
+
+signals:
+    void filterChanged();
+
+private:
+    QString m_filter;
+};
+
+#endif // TIMEZONEMODEL_H
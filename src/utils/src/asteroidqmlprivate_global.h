@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef ASTEROIDQMLPRIVATE_GLOBAL_H
+#define ASTEROIDQMLPRIVATE_GLOBAL_H
+
+#include <QtGlobal>
+
+/*
+ * asteroidqmlprivate holds the process-wide state shared by the QML plugins of
+ * this repository. It is not public API: no headers are installed and its
+ * soname changes with every release.
+ */
+#if defined(ASTEROIDQMLPRIVATE_LIBRARY)
+#  define ASTEROIDQMLPRIVATE_EXPORT Q_DECL_EXPORT
+#else
+#  define ASTEROIDQMLPRIVATE_EXPORT Q_DECL_IMPORT
+#endif
+
+#endif // ASTEROIDQMLPRIVATE_GLOBAL_H
@@ -0,0 +1,396 @@
+/*
+ * Copyright (C) 2026 - Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "bluetoothbackend.h"
+#include "dbusproxy.h"
+
+#include <QDBusServiceWatcher>
+#include <QDBusConnection>
+#include <QDBusArgument>
+#include <QDBusMessage>
+#include <QDBusPendingCall>
+#include <QDBusPendingCallWatcher>
+
+#include <QDBusMetaType>
+#include <QDebug>
+#include <QCoreApplication>
+#include <QTimer>
+
+BluetoothBackend *BluetoothBackend::instance()
+{
+    static BluetoothBackend *s_instance = [] {
+        auto *backend = new BluetoothBackend;
+        if (QCoreApplication::instance())
+            backend->moveToThread(QCoreApplication::instance()->thread());
+        return backend;
+    }();
+    return s_instance;
+}
+
+BluetoothBackend::BluetoothBackend() : QObject(), mBus(QDBusConnection::systemBus())
+{
+    mPowered = false;
+    mConnected = false;
+    mManagerSubscribed = false;
+    mRefreshInFlight = false;
+    mRefreshQueued = false;
+    mPoweredPending = false;
+    mPoweredRequested = false;
+    mPoweredRequest = 0;
+
+    mRefreshTimer = new QTimer(this);
+    mRefreshTimer->setSingleShot(true);
+    mRefreshTimer->setInterval(100);
+    connect(mRefreshTimer, &QTimer::timeout, this, &BluetoothBackend::fetchManagedObjects);
+
+    qDBusRegisterMetaType<InterfaceList>();
+
+    mWatcher = new QDBusServiceWatcher("org.bluez", mBus, QDBusServiceWatcher::WatchForOwnerChange, this);
+    connect(mWatcher, SIGNAL(serviceRegistered(const QString&)), this, SLOT(serviceRegistered(const QString&)));
+    connect(mWatcher, SIGNAL(serviceUnregistered(const QString&)), this, SLOT(serviceUnregistered(const QString&)));
+
+    // Subscribe and kick off an async fetch unconditionally; if org.bluez is
+    // not up yet the reply just errors out (treated as unpowered) and the
+    // service watcher re-fetches once it appears.
+    serviceRegistered("org.bluez");
+}
+
+static const QString ADAPTER_IFACE = QStringLiteral("org.bluez.Adapter1");
+static const QString DEVICE_IFACE = QStringLiteral("org.bluez.Device1");
+static const QString BATTERY_IFACE = QStringLiteral("org.bluez.Battery1");
+
+static DBusProxy *objectManager()
+{
+    return DBusProxy::systemBus("org.bluez", "/", "org.freedesktop.DBus.ObjectManager");
+}
+
+static bool isMirrored(const QString &interface)
+{
+    return interface == ADAPTER_IFACE || interface == DEVICE_IFACE || interface == BATTERY_IFACE;
+}
+
+void BluetoothBackend::serviceRegistered(const QString& name)
+{
+    if (!mManagerSubscribed) {
+        objectManager()->connect("InterfacesAdded", this, SLOT(InterfacesAdded(QDBusObjectPath, InterfaceList)));
+        objectManager()->connect("InterfacesRemoved", this, SLOT(InterfacesRemoved(QDBusObjectPath, QStringList)));
+        mManagerSubscribed = true;
+    }
+
+    refresh();
+}
+
+void BluetoothBackend::serviceUnregistered(const QString& name)
+{
+    const QMap<QString, InterfaceList> before = mObjects;
+    mObjects.clear();
+    syncSubscriptions();
+    for (auto it = before.cbegin(); it != before.cend(); ++it)
+        notifyDevice(it.key(), it.value());
+    updateState();
+}
+
+QStringList BluetoothBackend::devices() const
+{
+    QStringList paths;
+    for (auto it = mObjects.cbegin(); it != mObjects.cend(); ++it) {
+        if (it->contains(DEVICE_IFACE))
+            paths.append(it.key());
+    }
+    return paths;
+}
+
+QVariant BluetoothBackend::deviceProperty(const QString &path, const QString &name) const
+{
+    auto object = mObjects.constFind(path);
+    if (object == mObjects.cend())
+        return QVariant();
+
+    auto device = object->constFind(DEVICE_IFACE);
+    if (device != object->cend() && device->contains(name))
+        return device->value(name);
+    return object->value(BATTERY_IFACE).value(name);
+}
+
+// Compare a device against its previous state in the mirror and tell the
+// models exactly what happened to it.
+void BluetoothBackend::notifyDevice(const QString &path, const InterfaceList &before)
+{
+    const InterfaceList after = mObjects.value(path);
+    const bool had = before.contains(DEVICE_IFACE);
+    const bool has = after.contains(DEVICE_IFACE);
+
+    if (!had && has) {
+        emit deviceAdded(path);
+    } else if (had && !has) {
+        emit deviceRemoved(path);
+    } else if (has) {
+        QStringList changed;
+        for (const QString &interface : { DEVICE_IFACE, BATTERY_IFACE }) {
+            const QVariantMap oldProperties = before.value(interface);
+            const QVariantMap newProperties = after.value(interface);
+            for (auto it = newProperties.cbegin(); it != newProperties.cend(); ++it) {
+                if (oldProperties.value(it.key()) != it.value())
+                    changed.append(it.key());
+            }
+            for (auto it = oldProperties.cbegin(); it != oldProperties.cend(); ++it) {
+                if (!newProperties.contains(it.key()))
+                    changed.append(it.key());
+            }
+        }
+        if (!changed.isEmpty())
+            emit deviceChanged(path, changed);
+    }
+}
+
+// Each mirrored object gets exactly one PropertiesChanged match, dropped again
+// as soon as the object leaves the mirror.
+void BluetoothBackend::subscribe(const QString &path)
+{
+    if (mSubscribedPaths.contains(path))
+        return;
+    if (mBus.connect("org.bluez", path, "org.freedesktop.DBus.Properties", "PropertiesChanged", this, SLOT(PropertiesChanged(QString, QVariantMap, QStringList, QDBusMessage))))
+        mSubscribedPaths.insert(path);
+}
+
+void BluetoothBackend::unsubscribe(const QString &path)
+{
+    if (!mSubscribedPaths.remove(path))
+        return;
+    mBus.disconnect("org.bluez", path, "org.freedesktop.DBus.Properties", "PropertiesChanged", this, SLOT(PropertiesChanged(QString, QVariantMap, QStringList, QDBusMessage)));
+}
+
+void BluetoothBackend::syncSubscriptions()
+{
+    const QSet<QString> subscribed = mSubscribedPaths;
+    for (const QString &path : subscribed) {
+        if (!mObjects.contains(path))
+            unsubscribe(path);
+    }
+}
+
+// Requests arriving while a fetch is in flight are folded into a single
+// follow-up fetch, and bursts are absorbed by the debounce timer.
+void BluetoothBackend::refresh()
+{
+    if (mRefreshInFlight)
+        mRefreshQueued = true;
+    else if (!mRefreshTimer->isActive())
+        mRefreshTimer->start();
+}
+
+int BluetoothBackend::refreshDelay() const
+{
+    return mRefreshTimer->interval();
+}
+
+void BluetoothBackend::setRefreshDelay(int delay)
+{
+    delay = qMax(delay, 0);
+    if (mRefreshTimer->interval() == delay)
+        return;
+    mRefreshTimer->setInterval(delay);
+    emit refreshDelayChanged();
+}
+
+void BluetoothBackend::fetchManagedObjects()
+{
+    mRefreshInFlight = true;
+
+    objectManager()->call("GetManagedObjects", QVariantList(), this, [this](const QDBusMessage &reply) {
+        mRefreshInFlight = false;
+        handleManagedObjects(reply);
+
+        if (mRefreshQueued) {
+            mRefreshQueued = false;
+            refresh();
+        }
+    });
+}
+
+void BluetoothBackend::handleManagedObjects(const QDBusMessage &reply)
+{
+    const QMap<QString, InterfaceList> before = mObjects;
+    mObjects.clear();
+
+    if (reply.type() == QDBusMessage::ReplyMessage && !reply.arguments().isEmpty()) {
+        const QDBusArgument argument = reply.arguments().at(0).value<QDBusArgument>();
+        if (argument.currentType() == QDBusArgument::MapType) {
+            argument.beginMap();
+            while (!argument.atEnd()) {
+                    QString key;
+                    InterfaceList value;
+
+                    argument.beginMapEntry();
+                    argument >> key >> value;
+                    argument.endMapEntry();
+
+                    addInterfaces(key, value);
+            }
+            argument.endMap();
+        }
+    }
+
+    syncSubscriptions();
+    for (auto it = before.cbegin(); it != before.cend(); ++it)
+        notifyDevice(it.key(), it.value());
+    for (auto it = mObjects.cbegin(); it != mObjects.cend(); ++it) {
+        if (!before.contains(it.key()))
+            notifyDevice(it.key(), InterfaceList());
+    }
+    updateState();
+}
+
+// Merge the interfaces we care about into the mirror and watch their
+// properties from now on.
+void BluetoothBackend::addInterfaces(const QString &path, const InterfaceList &interfaces)
+{
+    for (auto it = interfaces.cbegin(); it != interfaces.cend(); ++it) {
+        if (!isMirrored(it.key()))
+            continue;
+        subscribe(path);
+        mObjects[path][it.key()] = it.value();
+    }
+}
+
+void BluetoothBackend::updateState()
+{
+    bool powered = false;
+    bool connected = false;
+
+    for (const InterfaceList &interfaces : std::as_const(mObjects)) {
+        powered |= interfaces.value(ADAPTER_IFACE).value("Powered").toBool();
+        connected |= interfaces.value(DEVICE_IFACE).value("Connected").toBool();
+    }
+    if (mPoweredPending)
+        powered = mPoweredRequested;
+
+    if(powered != mPowered) {
+        mPowered = powered;
+        emit poweredChanged();
+    }
+
+    if(connected != mConnected) {
+        mConnected = connected;
+        emit connectedChanged();
+    }
+}
+
+void BluetoothBackend::InterfacesAdded(QDBusObjectPath path, InterfaceList interfaces)
+{
+    const InterfaceList before = mObjects.value(path.path());
+    addInterfaces(path.path(), interfaces);
+    notifyDevice(path.path(), before);
+    updateState();
+}
+
+void BluetoothBackend::InterfacesRemoved(QDBusObjectPath path, QStringList interfaces)
+{
+    auto object = mObjects.find(path.path());
+    if (object == mObjects.end())
+        return;
+
+    const InterfaceList before = *object;
+    for (const QString &interface : std::as_const(interfaces))
+        object->remove(interface);
+    if (object->isEmpty()) {
+        mObjects.erase(object);
+        unsubscribe(path.path());
+    }
+
+    notifyDevice(path.path(), before);
+    updateState();
+}
+
+void BluetoothBackend::PropertiesChanged(QString interface, QVariantMap changed, QStringList invalidated, QDBusMessage message)
+{
+    if (!isMirrored(interface))
+        return;
+
+    auto object = mObjects.find(message.path());
+    if (object == mObjects.end() || !object->contains(interface)) {
+        // We missed this object appearing, our mirror can't be trusted.
+        refresh();
+        return;
+    }
+
+    QVariantMap &properties = (*object)[interface];
+    for (auto it = changed.cbegin(); it != changed.cend(); ++it)
+        properties.insert(it.key(), it.value());
+    for (const QString &name : std::as_const(invalidated))
+        properties.remove(name);
+
+    if (interface != ADAPTER_IFACE && object->contains(DEVICE_IFACE))
+        emit deviceChanged(message.path(), changed.keys() + invalidated);
+
+    updateState();
+}
+
+QString BluetoothBackend::adapterPath() const
+{
+    for (auto it = mObjects.cbegin(); it != mObjects.cend(); ++it) {
+        if (it->contains(ADAPTER_IFACE))
+            return it.key();
+    }
+    return QString();
+}
+
+// The new state is shown right away and only reverted if BlueZ refuses it.
+quint32 BluetoothBackend::setPowered(bool powered)
+{
+    const quint32 serial = ++mPoweredRequest;
+    const QString path = adapterPath();
+    if (path.isEmpty()) {
+        // This is now the latest request, nothing is pending any more
+        mPoweredPending = false;
+        updateState();
+        // Queued so that the caller knows the request number by then
+        QMetaObject::invokeMethod(this, [this, serial]() {
+            emit setPoweredFinished(serial, false, QStringLiteral("No Bluetooth adapter available"));
+        }, Qt::QueuedConnection);
+        return serial;
+    }
+
+    mPoweredPending = true;
+    mPoweredRequested = powered;
+    updateState();
+
+    QDBusPendingCall call = DBusProxy::systemBus("org.bluez", path, ADAPTER_IFACE)->setProperty("Powered", powered);
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(call, this);
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, [this, path, powered, serial](QDBusPendingCallWatcher *w) {
+        QDBusMessage reply = w->reply();
+        w->deleteLater();
+
+        const bool success = reply.type() == QDBusMessage::ReplyMessage;
+        if (success) {
+            // BlueZ accepted it, don't wait for PropertiesChanged to agree.
+            auto object = mObjects.find(path);
+            if (object != mObjects.end() && object->contains(ADAPTER_IFACE))
+                (*object)[ADAPTER_IFACE].insert("Powered", powered);
+        } else {
+            qWarning() << "BluetoothStatus: failed to power" << (powered ? "on" : "off") << path << reply.errorMessage();
+        }
+
+        // Only the latest request decides what is displayed.
+        if (serial == mPoweredRequest) {
+            mPoweredPending = false;
+            updateState();
+        }
+        emit setPoweredFinished(serial, success, success ? QString() : reply.errorMessage());
+    });
+    return serial;
+}
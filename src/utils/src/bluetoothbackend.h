@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 - Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BLUETOOTHBACKEND_H
+#define BLUETOOTHBACKEND_H
+
+#include <QObject>
+#include <QMap>
+#include <QString>
+#include <QVariant>
+#include <QStringList>
+#include <QSet>
+#include <QDBusObjectPath>
+#include <QDBusConnection>
+#include <QDBusMessage>
+#include <QDBusServiceWatcher>
+
+class QTimer;
+
+typedef QMap<QString, QMap<QString, QVariant>> InterfaceList;
+Q_DECLARE_METATYPE(InterfaceList)
+
+/*
+ * Process-wide owner of the BlueZ D-Bus state.
+ *
+ * Watches org.bluez, keeps the mirror of its object tree and the matching
+ * subscriptions. The QML types of this plugin are thin front-ends reading from
+ * this single instance, so bus traffic does not grow with the number of them.
+ * Must be used from the GUI thread.
+ */
+class BluetoothBackend : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY(BluetoothBackend)
+
+public:
+    static BluetoothBackend *instance();
+
+    bool powered() const { return mPowered; }
+    // Asynchronous, completion is reported by setPoweredFinished() with the
+    // request number returned here
+    quint32 setPowered(bool powered);
+    bool connected() const { return mConnected; }
+    int refreshDelay() const;
+    void setRefreshDelay(int delay);
+
+    // Object paths of the known devices, in a stable order
+    QStringList devices() const;
+    // Property of a device, looked up in org.bluez.Device1 then org.bluez.Battery1
+    QVariant deviceProperty(const QString &path, const QString &name) const;
+
+signals:
+    void connectedChanged();
+    void poweredChanged();
+    void refreshDelayChanged();
+    void deviceAdded(const QString &path);
+    void deviceRemoved(const QString &path);
+    void deviceChanged(const QString &path, const QStringList &properties);
+    void setPoweredFinished(quint32 request, bool success, const QString &error);
+
+private slots:
+    void serviceRegistered(const QString& name);
+    void serviceUnregistered(const QString& name);
+    void InterfacesAdded(QDBusObjectPath, InterfaceList);
+    void InterfacesRemoved(QDBusObjectPath, QStringList);
+    void PropertiesChanged(QString, QVariantMap, QStringList, QDBusMessage);
+
+private:
+    BluetoothBackend();
+
+    // Asynchronously fetch the whole BlueZ object tree to (re)seed the mirror.
+    // Only needed when org.bluez (re)appears, signals keep it up to date.
+    // At most one fetch is in flight and at most one more is queued.
+    void refresh();
+    void fetchManagedObjects();
+    void handleManagedObjects(const QDBusMessage &reply);
+    void addInterfaces(const QString &path, const InterfaceList &interfaces);
+    void updateState();
+    void subscribe(const QString &path);
+    void unsubscribe(const QString &path);
+    void syncSubscriptions();
+    void notifyDevice(const QString &path, const InterfaceList &before);
+    QString adapterPath() const;
+
+    bool mConnected, mPowered;
+    // Local mirror of the adapters and devices: path -> interface -> properties
+    QMap<QString, InterfaceList> mObjects;
+    QSet<QString> mSubscribedPaths;
+    bool mManagerSubscribed;
+    bool mRefreshInFlight, mRefreshQueued;
+    // Optimistic powered state while a Set call is pending
+    bool mPoweredPending, mPoweredRequested;
+    quint32 mPoweredRequest;
+    QTimer *mRefreshTimer;
+    QDBusConnection mBus;
+    QDBusServiceWatcher *mWatcher;
+};
+
+#endif // BLUETOOTHBACKEND_H
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 - Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bluetoothdevicemodel.h"
+#include "bluetoothbackend.h"
+
+BluetoothDeviceModel::BluetoothDeviceModel(QObject *parent) : QAbstractListModel(parent)
+{
+    BluetoothBackend *backend = BluetoothBackend::instance();
+    m_paths = backend->devices();
+
+    connect(backend, &BluetoothBackend::deviceAdded, this, &BluetoothDeviceModel::onDeviceAdded);
+    connect(backend, &BluetoothBackend::deviceRemoved, this, &BluetoothDeviceModel::onDeviceRemoved);
+    connect(backend, &BluetoothBackend::deviceChanged, this, &BluetoothDeviceModel::onDeviceChanged);
+}
+
+int BluetoothDeviceModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_paths.size();
+}
+
+QVariant BluetoothDeviceModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_paths.size())
+        return QVariant();
+
+    const QString &path = m_paths.at(index.row());
+    const BluetoothBackend *backend = BluetoothBackend::instance();
+
+    switch (role) {
+    case PathRole:
+        return path;
+    case NameRole: {
+        QVariant name = backend->deviceProperty(path, "Alias");
+        if (!name.isValid())
+            name = backend->deviceProperty(path, "Name");
+        return name.isValid() ? name : backend->deviceProperty(path, "Address");
+    }
+    case AddressRole:
+        return backend->deviceProperty(path, "Address");
+    case ConnectedRole:
+        return backend->deviceProperty(path, "Connected").toBool();
+    case BatteryRole: {
+        const QVariant percentage = backend->deviceProperty(path, "Percentage");
+        return percentage.isValid() ? percentage.toInt() : -1;
+    }
+    case RssiRole:
+        return backend->deviceProperty(path, "RSSI");
+    }
+    return QVariant();
+}
+
+QHash<int, QByteArray> BluetoothDeviceModel::roleNames() const
+{
+    return {
+        { PathRole,      "path" },
+        { NameRole,      "name" },
+        { AddressRole,   "address" },
+        { ConnectedRole, "connected" },
+        { BatteryRole,   "battery" },
+        { RssiRole,      "rssi" },
+    };
+}
+
+void BluetoothDeviceModel::onDeviceAdded(const QString &path)
+{
+    if (m_paths.contains(path))
+        return;
+
+    beginInsertRows(QModelIndex(), m_paths.size(), m_paths.size());
+    m_paths.append(path);
+    endInsertRows();
+    emit countChanged();
+}
+
+void BluetoothDeviceModel::onDeviceRemoved(const QString &path)
+{
+    const int row = m_paths.indexOf(path);
+    if (row < 0)
+        return;
+
+    beginRemoveRows(QModelIndex(), row, row);
+    m_paths.removeAt(row);
+    endRemoveRows();
+    emit countChanged();
+}
+
+void BluetoothDeviceModel::onDeviceChanged(const QString &path, const QStringList &properties)
+{
+    const int row = m_paths.indexOf(path);
+    if (row < 0)
+        return;
+
+    QList<int> roles;
+    auto addRole = [&roles](int role) {
+        if (!roles.contains(role))
+            roles.append(role);
+    };
+    for (const QString &property : properties) {
+        if (property == "Alias" || property == "Name")
+            addRole(NameRole);
+        else if (property == "Address")
+            addRole(AddressRole);
+        else if (property == "Connected")
+            addRole(ConnectedRole);
+        else if (property == "Percentage")
+            addRole(BatteryRole);
+        else if (property == "RSSI")
+            addRole(RssiRole);
+    }
+
+    if (!roles.isEmpty())
+        emit dataChanged(index(row), index(row), roles);
+}
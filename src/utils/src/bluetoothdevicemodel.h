@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2026 - Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BLUETOOTHDEVICEMODEL_H
+#define BLUETOOTHDEVICEMODEL_H
+
+#include <QAbstractListModel>
+#include <QStringList>
+
+/*
+ * Bluetooth devices known to BlueZ, with their name, address, connection
+ * state, battery level and RSSI.
+ *
+ * Reads the object tree mirrored by BluetoothBackend and follows it with
+ * row insertions, removals and per-role dataChanged, never resets. battery is
+ * -1 and rssi undefined when BlueZ does not report them.
+ */
+class BluetoothDeviceModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
+
+public:
+    enum Roles { PathRole = Qt::UserRole + 1, NameRole, AddressRole, ConnectedRole, BatteryRole, RssiRole };
+    Q_ENUM(Roles)
+
+    explicit BluetoothDeviceModel(QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+signals:
+    void countChanged();
+
+private slots:
+    void onDeviceAdded(const QString &path);
+    void onDeviceRemoved(const QString &path);
+    void onDeviceChanged(const QString &path, const QStringList &properties);
+
+private:
+    QStringList m_paths;
+};
+
+#endif // BLUETOOTHDEVICEMODEL_H
@@ -14,142 +14,46 @@
  * You should have received a copy of the GNU General Public License
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
-
 #include "bluetoothstatus.h"
+#include "bluetoothbackend.h"
 
-#include <QDBusServiceWatcher>
-#include <QDBusConnection>
-#include <QDBusInterface>
-#include <QDBusArgument>
-#include <QDBusMessage>
-#include <QDBusPendingCall>
-#include <QDBusPendingCallWatcher>
-
-#include <QDBusMetaType>
-
-BluetoothStatus::BluetoothStatus(QObject *parent) : QObject(parent), mBus(QDBusConnection::systemBus())
-{
-    mPowered = false;
-    mConnected = false;
-
-    qDBusRegisterMetaType<InterfaceList>();
-
-    mWatcher = new QDBusServiceWatcher("org.bluez", QDBusConnection::systemBus());
-    connect(mWatcher, SIGNAL(serviceRegistered(const QString&)), this, SLOT(serviceRegistered(const QString&)));
-    connect(mWatcher, SIGNAL(serviceUnregistered(const QString&)), this, SLOT(serviceUnregistered(const QString&)));
-
-    // Subscribe and kick off an async fetch unconditionally; if org.bluez is
-    // not up yet the reply just errors out (treated as unpowered) and the
-    // service watcher re-fetches once it appears.
-    serviceRegistered("org.bluez");
-}
-
-void BluetoothStatus::serviceRegistered(const QString& name)
-{
-    mBus.connect("org.bluez", "/", "org.freedesktop.DBus.ObjectManager", "InterfacesAdded", this, SLOT(InterfacesAdded(QDBusObjectPath, InterfaceList)));
-    mBus.connect("org.bluez", "/", "org.freedesktop.DBus.ObjectManager", "InterfacesRemoved", this, SLOT(InterfacesRemoved(QDBusObjectPath, QStringList)));
-
-    refresh();
-}
-
-void BluetoothStatus::serviceUnregistered(const QString& name)
-{
-    if(mPowered) {
-        mPowered = false;
-        emit poweredChanged();
-    }
-
-    if(mConnected) {
-        mConnected = false;
-        emit connectedChanged();
-    }
-}
-
-void BluetoothStatus::refresh()
-{
-    QDBusInterface remoteOm("org.bluez", "/", "org.freedesktop.DBus.ObjectManager", mBus);
-    QDBusPendingCall call = remoteOm.asyncCall("GetManagedObjects");
-    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(call, this);
-    connect(watcher, &QDBusPendingCallWatcher::finished, this, [this](QDBusPendingCallWatcher *w) {
-        QDBusMessage reply = w->reply();
-        w->deleteLater();
-        handleManagedObjects(reply);
-    });
-}
-
-void BluetoothStatus::handleManagedObjects(const QDBusMessage &reply)
+BluetoothStatus::BluetoothStatus(QObject *parent) : QObject(parent)
 {
-    bool powered = false;
-    bool connected = false;
-
-    if (reply.type() == QDBusMessage::ReplyMessage && !reply.arguments().isEmpty()) {
-        const QDBusArgument argument = reply.arguments().at(0).value<QDBusArgument>();
-        if (argument.currentType() == QDBusArgument::MapType) {
-            argument.beginMap();
-            while (!argument.atEnd()) {
-                    QString key;
-                    InterfaceList value;
-
-                    argument.beginMapEntry();
-                    argument >> key >> value;
-                    argument.endMapEntry();
-
-                    if (value.contains("org.bluez.Adapter1")) {
-                         mBus.connect("org.bluez", key, "org.freedesktop.DBus.Properties", "PropertiesChanged", this, SLOT(PropertiesChanged(QString, QMap<QString, QVariant>, QStringList)));
-                         QMap<QString, QVariant> properties = value.value("org.bluez.Adapter1");
-                         if(properties.contains("Powered"))
-                            powered |= properties.value("Powered").toBool();
-                    }
-
-                    if (value.contains("org.bluez.Device1")) {
-                         mBus.connect("org.bluez", key, "org.freedesktop.DBus.Properties", "PropertiesChanged", this, SLOT(PropertiesChanged(QString, QMap<QString, QVariant>, QStringList)));
-                         QMap<QString, QVariant> properties = value.value("org.bluez.Device1");
-                         if(properties.contains("Connected"))
-                            connected |= properties.value("Connected").toBool();
-                    }
-            }
-            argument.endMap();
-        }
-    }
-
-    if(powered != mPowered) {
-        mPowered = powered;
-        emit poweredChanged();
-    }
-
-    if(connected != mConnected) {
-        mConnected = connected;
-        emit connectedChanged();
-    }
+    BluetoothBackend *backend = BluetoothBackend::instance();
+    connect(backend, &BluetoothBackend::poweredChanged, this, &BluetoothStatus::poweredChanged);
+    connect(backend, &BluetoothBackend::connectedChanged, this, &BluetoothStatus::connectedChanged);
+    connect(backend, &BluetoothBackend::refreshDelayChanged, this, &BluetoothStatus::refreshDelayChanged);
+    connect(backend, &BluetoothBackend::setPoweredFinished, this, &BluetoothStatus::onSetPoweredFinished);
 }
 
-void BluetoothStatus::InterfacesAdded(QDBusObjectPath, InterfaceList)
+bool BluetoothStatus::getPowered()
 {
-    refresh();
+    return BluetoothBackend::instance()->powered();
 }
 
-void BluetoothStatus::InterfacesRemoved(QDBusObjectPath, QStringList)
+bool BluetoothStatus::getConnected()
 {
-    refresh();
+    return BluetoothBackend::instance()->connected();
 }
 
-void BluetoothStatus::PropertiesChanged(QString, QMap<QString, QVariant>, QStringList)
+void BluetoothStatus::setPowered(bool powered)
 {
-    refresh();
+    mPoweredRequests.insert(BluetoothBackend::instance()->setPowered(powered));
 }
 
-bool BluetoothStatus::getPowered()
+// The backend reports every instance's requests, only ours are of interest.
+void BluetoothStatus::onSetPoweredFinished(quint32 request, bool success, const QString &error)
 {
-    return mPowered;
+    if (mPoweredRequests.remove(request))
+        emit setPoweredFinished(success, error);
 }
 
-bool BluetoothStatus::getConnected()
+int BluetoothStatus::refreshDelay() const
 {
-    return mConnected;
+    return BluetoothBackend::instance()->refreshDelay();
 }
 
-void BluetoothStatus::setPowered(bool powered)
+void BluetoothStatus::setRefreshDelay(int delay)
 {
-    QDBusInterface serviceManager("org.bluez", "/org/bluez/hci0", "org.bluez.Adapter1", mBus);
-    serviceManager.setProperty("Powered", powered);
+    BluetoothBackend::instance()->setRefreshDelay(delay);
 }
@@ -14,50 +14,44 @@
  * You should have received a copy of the GNU General Public License
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
+#ifndef BLUETOOTHSTATUS_H
+#define BLUETOOTHSTATUS_H
 
 #include <QObject>
-#include <QMap>
-#include <QString>
-#include <QVariant>
-#include <QStringList>
-#include <QDBusObjectPath>
-#include <QDBusConnection>
-#include <QDBusServiceWatcher>
-
-typedef QMap<QString, QMap<QString, QVariant>> InterfaceList;
-Q_DECLARE_METATYPE(InterfaceList)
+#include <QSet>
 
 class BluetoothStatus : public QObject
 {
     Q_OBJECT
     Q_PROPERTY(bool powered READ getPowered WRITE setPowered NOTIFY poweredChanged)
     Q_PROPERTY(bool connected READ getConnected NOTIFY connectedChanged)
+    // Debounce window in ms applied to full resyncs of the object tree, shared
+    // by all instances
+    Q_PROPERTY(int refreshDelay READ refreshDelay WRITE setRefreshDelay NOTIFY refreshDelayChanged)
 
 public:
     BluetoothStatus(QObject *parent = 0);
     void setPowered(bool);
     bool getPowered();
     bool getConnected();
-
-public slots:
-    void serviceRegistered(const QString& name);
-    void serviceUnregistered(const QString& name);
-    void InterfacesAdded(QDBusObjectPath, InterfaceList);
-    void InterfacesRemoved(QDBusObjectPath, QStringList);
-    void PropertiesChanged(QString, QMap<QString, QVariant>, QStringList);
+    int refreshDelay() const;
+    void setRefreshDelay(int delay);
 
 signals:
     void connectedChanged();
     void poweredChanged();
+    void refreshDelayChanged();
+    // Result of a powered change made through this instance, the property
+    // already shows the requested state while it is in progress and reverts
+    // if it fails
+    void setPoweredFinished(bool success, const QString &error);
 
-private:
-    // Asynchronously fetch the BlueZ object tree and recompute powered/connected
-    // from a single GetManagedObjects reply, off the GUI thread.
-    void refresh();
-    void handleManagedObjects(const class QDBusMessage &reply);
+private slots:
+    void onSetPoweredFinished(quint32 request, bool success, const QString &error);
 
-    bool mConnected, mPowered;
-    QDBusConnection mBus;
-    QDBusServiceWatcher *mWatcher;
+private:
+    // Backend requests issued by this instance and not finished yet
+    QSet<quint32> mPoweredRequests;
 };
 
+#endif // BLUETOOTHSTATUS_H
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "dbusproxy.h"
+
+#include <QDBusPendingCallWatcher>
+#include <QDBusVariant>
+#include <QHash>
+#include <QObject>
+
+static const QString PROPERTIES_IFACE = QStringLiteral("org.freedesktop.DBus.Properties");
+
+DBusProxy *DBusProxy::systemBus(const QString &service, const QString &path, const QString &interface)
+{
+    return forBus(QDBusConnection::systemBus(), service, path, interface);
+}
+
+DBusProxy *DBusProxy::forBus(const QDBusConnection &bus, const QString &service, const QString &path,
+                             const QString &interface)
+{
+    static QHash<QString, DBusProxy *> s_proxies;
+
+    const QString key = bus.name() + QLatin1Char(' ') + service + QLatin1Char(' ') + path
+            + QLatin1Char(' ') + interface;
+    DBusProxy *&proxy = s_proxies[key];
+    if (!proxy)
+        proxy = new DBusProxy(bus, service, path, interface);
+    return proxy;
+}
+
+DBusProxy::DBusProxy(const QDBusConnection &bus, const QString &service, const QString &path, const QString &interface)
+    : m_bus(bus), m_service(service), m_path(path), m_interface(interface)
+{
+}
+
+QDBusMessage DBusProxy::methodCall(const QString &method, const QVariantList &arguments) const
+{
+    QDBusMessage message = QDBusMessage::createMethodCall(m_service, m_path, m_interface, method);
+    message.setArguments(arguments);
+    return message;
+}
+
+QDBusMessage DBusProxy::propertiesCall(const QString &method, const QVariantList &arguments) const
+{
+    QDBusMessage message = QDBusMessage::createMethodCall(m_service, m_path, PROPERTIES_IFACE, method);
+    message.setArguments(arguments);
+    return message;
+}
+
+QDBusPendingCall DBusProxy::asyncCall(const QString &method, const QVariantList &arguments) const
+{
+    return m_bus.asyncCall(methodCall(method, arguments));
+}
+
+void DBusProxy::call(const QString &method, const QVariantList &arguments, QObject *context,
+                     std::function<void(const QDBusMessage &)> callback) const
+{
+    auto *watcher = new QDBusPendingCallWatcher(asyncCall(method, arguments), context);
+    QObject::connect(watcher, &QDBusPendingCallWatcher::finished, context,
+                     [callback](QDBusPendingCallWatcher *w) {
+        QDBusMessage reply = w->reply();
+        w->deleteLater();
+        callback(reply);
+    });
+}
+
+QDBusPendingCall DBusProxy::getProperty(const QString &name) const
+{
+    return m_bus.asyncCall(propertiesCall("Get", { m_interface, name }));
+}
+
+QDBusPendingCall DBusProxy::getAllProperties() const
+{
+    return m_bus.asyncCall(propertiesCall("GetAll", { m_interface }));
+}
+
+QDBusPendingCall DBusProxy::setProperty(const QString &name, const QVariant &value) const
+{
+    return m_bus.asyncCall(propertiesCall("Set", { m_interface, name, QVariant::fromValue(QDBusVariant(value)) }));
+}
+
+bool DBusProxy::connect(const QString &signal, QObject *receiver, const char *slot) const
+{
+    return m_bus.connect(m_service, m_path, m_interface, signal, receiver, slot);
+}
+
+bool DBusProxy::disconnect(const QString &signal, QObject *receiver, const char *slot) const
+{
+    return m_bus.disconnect(m_service, m_path, m_interface, signal, receiver, slot);
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef DBUSPROXY_H
+#define DBUSPROXY_H
+
+#include "asteroidqmlprivate_global.h"
+
+#include <QDBusConnection>
+#include <QDBusMessage>
+#include <QDBusPendingCall>
+#include <QString>
+#include <QVariant>
+#include <functional>
+
+class QObject;
+
+/*
+ * Handle on one (service, path, interface) of a bus, usually the system bus.
+ *
+ * Unlike QDBusInterface it never introspects the remote object: calls are
+ * plain QDBusMessages sent asynchronously. Handles are created once per tuple
+ * and shared by the whole process, they live until it exits. Lives in the
+ * private asteroidqmlprivate library, so the utils and settings plugins use the
+ * same handles. Must be used from the GUI thread.
+ */
+class ASTEROIDQMLPRIVATE_EXPORT DBusProxy
+{
+    Q_DISABLE_COPY(DBusProxy)
+public:
+    static DBusProxy *systemBus(const QString &service, const QString &path, const QString &interface);
+    static DBusProxy *forBus(const QDBusConnection &bus, const QString &service, const QString &path,
+                             const QString &interface);
+
+    const QString &service() const { return m_service; }
+    const QString &path() const { return m_path; }
+    const QString &interface() const { return m_interface; }
+
+    QDBusPendingCall asyncCall(const QString &method, const QVariantList &arguments = QVariantList()) const;
+    // Invokes callback with the reply (or error) message, unless context is
+    // destroyed first.
+    void call(const QString &method, const QVariantList &arguments, QObject *context,
+              std::function<void(const QDBusMessage &)> callback) const;
+
+    // org.freedesktop.DBus.Properties on the same object and interface
+    QDBusPendingCall getProperty(const QString &name) const;
+    QDBusPendingCall getAllProperties() const;
+    QDBusPendingCall setProperty(const QString &name, const QVariant &value) const;
+
+    bool connect(const QString &signal, QObject *receiver, const char *slot) const;
+    bool disconnect(const QString &signal, QObject *receiver, const char *slot) const;
+
+private:
+    DBusProxy(const QDBusConnection &bus, const QString &service, const QString &path, const QString &interface);
+    QDBusMessage methodCall(const QString &method, const QVariantList &arguments) const;
+    QDBusMessage propertiesCall(const QString &method, const QVariantList &arguments) const;
+
+    QDBusConnection m_bus;
+    const QString m_service;
+    const QString m_path;
+    const QString m_interface;
+};
+
+#endif // DBUSPROXY_H
@@ -16,88 +16,55 @@
  */
 
 #include "devicespecs.h"
-#include <QFile>
-
-const char* CONFIG_FILE = "/etc/asteroid/machine.conf";
-const char* HOST_FILE = "/etc/hostname";
-const char* OS_RELEASE_FILE = "/etc/os-release";
+#include "machineconfig.h"
+#include "systemidentity.h"
 
 DeviceSpecs::DeviceSpecs()
-    : m_settings(CONFIG_FILE, QSettings::IniFormat)
 {
-    QSettings::Status status(m_settings.status());
-    if (status == QSettings::FormatError ) {
-        qWarning("Configuration file \"%s\" is in wrong format", CONFIG_FILE);
-    } else if (status != QSettings::NoError) {
-        qWarning("Unable to open \"%s\" configuration file", CONFIG_FILE);
-    }
-
-    QFile host(HOST_FILE);
-    if (host.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QTextStream in(&host);
-        in.setEncoding(QStringConverter::Utf8);
-        m_hostname = in.readLine();
-        host.close();
-    }
-
-    QFile release(OS_RELEASE_FILE);
-    if (release.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QTextStream in(&release);
-        in.setEncoding(QStringConverter::Utf8);
-        QString line = in.readLine();
-        for (bool searching{true}; searching && !in.atEnd(); line = in.readLine()) {
-            if (line.startsWith("BUILD_ID")) {
-                auto parts = line.split(QLatin1Char('='));
-                m_buildid = parts[1];
-                m_buildid.remove(QChar('"'));
-                searching = false;
-            }
-        }
-        release.close();
-    }
+    connect(MachineConfig::instance(), &MachineConfig::changed, this, &DeviceSpecs::machineConfigChanged);
 }
 
 bool DeviceSpecs::hasRoundScreen()
 {
-    return m_settings.value("Display/ROUND", false).toBool();
+    return MachineConfig::data().roundScreen;
 }
 
 double DeviceSpecs::borderGestureWidth()
 {
-    return m_settings.value("Display/BORDER_GESTURE_WIDTH", 0.1).toFloat();
+    return MachineConfig::data().borderGestureWidth;
 }
 
 int DeviceSpecs::flatTireHeight()
 {
-    return m_settings.value("Display/FLAT_TIRE", 0).toInt();
+    return MachineConfig::data().flatTireHeight;
 }
 
 bool DeviceSpecs::needsBurnInProtection()
 {
-    return m_settings.value("Display/NEEDS_BURN_IN_PROTECTION", true).toBool();
+    return MachineConfig::data().needsBurnInProtection;
 }
 
 bool DeviceSpecs::hasWlan()
 {
-    return m_settings.value("Capabilities/HAS_WLAN", false).toBool();
+    return MachineConfig::data().hasWlan;
 }
 
 bool DeviceSpecs::hasSpeaker()
 {
-    return m_settings.value("Capabilities/HAS_SPEAKER", false).toBool();
+    return MachineConfig::data().hasSpeaker;
 }
 
 QString DeviceSpecs::hostname() const
 {
-    return m_hostname;
+    return SystemIdentity::instance().hostname();
 }
 
 QString DeviceSpecs::machineName() const
 {
-    return m_settings.value("Identity/MACHINE", "unknown").toString();
+    return MachineConfig::data().machineName;
 }
 
 QString DeviceSpecs::buildID() const
 {
-    return m_buildid;
+    return SystemIdentity::instance().osRelease("BUILD_ID");
 }
@@ -21,20 +21,19 @@
 #include <QObject>
 #include <QJSEngine>
 #include <QQmlEngine>
-#include <QSettings>
 
 class DeviceSpecs : public QObject
 {
     Q_OBJECT
     Q_DISABLE_COPY(DeviceSpecs)
-    Q_PROPERTY(bool hasRoundScreen READ hasRoundScreen CONSTANT)
-    Q_PROPERTY(double borderGestureWidth READ borderGestureWidth CONSTANT)
-    Q_PROPERTY(int flatTireHeight READ flatTireHeight CONSTANT)
-    Q_PROPERTY(bool needsBurnInProtection READ needsBurnInProtection CONSTANT)
-    Q_PROPERTY(bool hasWlan READ hasWlan CONSTANT)
-    Q_PROPERTY(bool hasSpeaker READ hasSpeaker CONSTANT)
+    Q_PROPERTY(bool hasRoundScreen READ hasRoundScreen NOTIFY machineConfigChanged)
+    Q_PROPERTY(double borderGestureWidth READ borderGestureWidth NOTIFY machineConfigChanged)
+    Q_PROPERTY(int flatTireHeight READ flatTireHeight NOTIFY machineConfigChanged)
+    Q_PROPERTY(bool needsBurnInProtection READ needsBurnInProtection NOTIFY machineConfigChanged)
+    Q_PROPERTY(bool hasWlan READ hasWlan NOTIFY machineConfigChanged)
+    Q_PROPERTY(bool hasSpeaker READ hasSpeaker NOTIFY machineConfigChanged)
     Q_PROPERTY(QString hostname READ hostname CONSTANT)
-    Q_PROPERTY(QString machineName READ machineName CONSTANT)
+    Q_PROPERTY(QString machineName READ machineName NOTIFY machineConfigChanged)
     Q_PROPERTY(QString buildID READ buildID CONSTANT)
     DeviceSpecs();
 public:
@@ -54,10 +53,8 @@ public:
     QString hostname() const;
     QString machineName() const;
     QString buildID() const;
-private:
-    QSettings m_settings;
-    QString m_hostname;
-    QString m_buildid;
+signals:
+    void machineConfigChanged();
 };
 
 #endif // DEVICESPECS_H
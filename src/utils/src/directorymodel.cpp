@@ -0,0 +1,433 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "directorymodel.h"
+
+#include <QDebug>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QPromise>
+#include <QRegularExpression>
+#include <QThreadPool>
+#include <algorithm>
+#include <memory>
+
+// Small enough for the first rows to show up before the folder is read
+static const int FIRST_BATCH_SIZE = 16;
+// Lets a burst of changes, e.g. a copy of many files, settle first
+static const int REFRESH_DELAY = 200;
+
+// Directories first, then by name ignoring case
+static bool entryLessThan(const DirectoryEntry &a, const DirectoryEntry &b)
+{
+    if (a.isDir != b.isDir)
+        return a.isDir;
+    const int order = a.name.compare(b.name, Qt::CaseInsensitive);
+    if (order != 0)
+        return order < 0;
+    return a.name < b.name;
+}
+
+namespace {
+struct ListingOptions {
+    QString path;
+    QStringList nameFilters;
+    QStringList suffixes;
+    bool showDirs = true;
+    bool showFiles = true;
+    int batchSize = 64;
+    bool streaming = true;
+};
+}
+
+// Runs on the global thread pool and stops at the next entry once the future
+// is cancelled.
+static void listDirectory(QPromise<QList<DirectoryEntry>> &promise, const ListingOptions &options)
+{
+    QList<QRegularExpression> patterns;
+    for (const QString &filter : options.nameFilters)
+        patterns.append(QRegularExpression::fromWildcard(filter, Qt::CaseInsensitive));
+
+    const int batchSize = qMax(options.batchSize, 1);
+    int nextBatch = qMin(FIRST_BATCH_SIZE, batchSize);
+    QList<DirectoryEntry> entries;
+
+    QDirIterator it(options.path, QDir::AllEntries | QDir::NoDotAndDotDot);
+    while (!promise.isCanceled() && it.hasNext()) {
+        it.next();
+        const QFileInfo info = it.fileInfo();
+        const bool isDir = info.isDir();
+        if (isDir ? !options.showDirs : !options.showFiles)
+            continue;
+
+        const QString name = info.fileName();
+        if (!isDir) {
+            if (!options.suffixes.isEmpty()
+                    && !options.suffixes.contains(info.suffix(), Qt::CaseInsensitive))
+                continue;
+            if (!patterns.isEmpty() && std::none_of(patterns.cbegin(), patterns.cend(),
+                    [&name](const QRegularExpression &re) { return re.match(name).hasMatch(); }))
+                continue;
+        }
+
+        entries.append({ name, isDir ? 0 : info.size(), info.lastModified(), isDir });
+        if (options.streaming && entries.size() >= nextBatch) {
+            promise.addResult(std::move(entries));
+            entries.clear();
+            nextBatch = batchSize;
+        }
+    }
+
+    if (promise.isCanceled())
+        return;
+    if (!options.streaming || !entries.isEmpty())
+        promise.addResult(std::move(entries));
+}
+
+DirectoryModel::DirectoryModel(QObject *parent) : QAbstractListModel(parent)
+{
+    m_refreshTimer.setSingleShot(true);
+    m_refreshTimer.setInterval(REFRESH_DELAY);
+    connect(&m_refreshTimer, &QTimer::timeout, this, &DirectoryModel::refresh);
+    connect(&m_watcher, &QFileSystemWatcher::directoryChanged, &m_refreshTimer,
+            qOverload<>(&QTimer::start));
+}
+
+DirectoryModel::~DirectoryModel()
+{
+    stopListing();
+}
+
+int DirectoryModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid())
+        return 0;
+    return m_entries.size();
+}
+
+QVariant DirectoryModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_entries.size())
+        return QVariant();
+
+    const DirectoryEntry &entry = m_entries.at(index.row());
+    switch (role) {
+    case Qt::DisplayRole:
+    case FileNameRole:
+        return entry.name;
+    case FilePathRole:
+        return filePath(index.row());
+    case FileUrlRole: {
+        const QString path = filePath(index.row());
+        if (path.startsWith(QLatin1Char(':')))
+            return QUrl(QLatin1String("qrc") + path);
+        return QUrl::fromLocalFile(path);
+    }
+    case FileBaseNameRole:
+        return entry.isDir ? entry.name : entry.name.section(QLatin1Char('.'), 0, 0);
+    case FileSuffixRole:
+        return entry.isDir ? QString() : QFileInfo(entry.name).suffix();
+    case FileSizeRole:
+        return entry.size;
+    case FileModifiedRole:
+        return entry.modified;
+    case FileIsDirRole:
+        return entry.isDir;
+    }
+    return QVariant();
+}
+
+QHash<int, QByteArray> DirectoryModel::roleNames() const
+{
+    return {
+        { FileNameRole, "fileName" },
+        { FilePathRole, "filePath" },
+        { FileUrlRole, "fileUrl" },
+        { FileBaseNameRole, "fileBaseName" },
+        { FileSuffixRole, "fileSuffix" },
+        { FileSizeRole, "fileSize" },
+        { FileModifiedRole, "fileModified" },
+        { FileIsDirRole, "fileIsDir" }
+    };
+}
+
+QString DirectoryModel::filePath(int row) const
+{
+    if (row < 0 || row >= m_entries.size())
+        return QString();
+    return m_path + QLatin1Char('/') + m_entries.at(row).name;
+}
+
+void DirectoryModel::setFolder(const QUrl &folder)
+{
+    if (m_folder == folder)
+        return;
+    m_folder = folder;
+    emit folderChanged();
+
+    // Resources are read through their ":/" path, anything else that is not
+    // local can't be listed.
+    QString path;
+    if (folder.isLocalFile())
+        path = folder.toLocalFile();
+    else if (folder.scheme() == QLatin1String("qrc"))
+        path = QLatin1Char(':') + folder.path();
+    else if (folder.scheme().isEmpty())
+        path = folder.path();
+    else if (!folder.isEmpty())
+        qWarning() << "DirectoryModel: can't list" << folder;
+    if (path.size() > 1 && path.endsWith(QLatin1Char('/')))
+        path.chop(1);
+    if (m_path != path) {
+        m_path = path;
+        queueReload();
+    }
+}
+
+void DirectoryModel::setNameFilters(const QStringList &filters)
+{
+    if (m_nameFilters == filters)
+        return;
+    m_nameFilters = filters;
+    emit nameFiltersChanged();
+    queueReload();
+}
+
+void DirectoryModel::setSuffixes(const QStringList &suffixes)
+{
+    if (m_suffixes == suffixes)
+        return;
+    m_suffixes = suffixes;
+    emit suffixesChanged();
+    queueReload();
+}
+
+void DirectoryModel::setShowDirs(bool show)
+{
+    if (m_showDirs == show)
+        return;
+    m_showDirs = show;
+    emit showDirsChanged();
+    queueReload();
+}
+
+void DirectoryModel::setShowFiles(bool show)
+{
+    if (m_showFiles == show)
+        return;
+    m_showFiles = show;
+    emit showFilesChanged();
+    queueReload();
+}
+
+void DirectoryModel::setBatchSize(int size)
+{
+    size = qMax(size, 1);
+    if (m_batchSize == size)
+        return;
+    m_batchSize = size;
+    emit batchSizeChanged();
+}
+
+// Deferred so that setting the folder and its filters in a row, as QML does
+// on creation, only lists once.
+void DirectoryModel::queueReload()
+{
+    if (m_reloadQueued)
+        return;
+    m_reloadQueued = true;
+    QMetaObject::invokeMethod(this, &DirectoryModel::reload, Qt::QueuedConnection);
+}
+
+void DirectoryModel::reload()
+{
+    m_reloadQueued = false;
+    m_refreshQueued = false;
+    m_refreshTimer.stop();
+    stopListing();
+
+    if (!m_watcher.directories().isEmpty())
+        m_watcher.removePaths(m_watcher.directories());
+
+    if (!m_entries.isEmpty()) {
+        beginResetModel();
+        m_entries.clear();
+        endResetModel();
+        emit countChanged();
+    }
+
+    if (m_path.isEmpty())
+        return;
+
+    if (!m_path.startsWith(QLatin1Char(':')))
+        m_watcher.addPath(m_path);
+    startListing(true);
+}
+
+void DirectoryModel::refresh()
+{
+    if (m_path.isEmpty())
+        return;
+    // Entries streamed so far may predate the change, check again once done
+    if (m_listing && m_listingStreaming) {
+        m_refreshQueued = true;
+        return;
+    }
+    stopListing();
+    startListing(false);
+}
+
+void DirectoryModel::startListing(bool streaming)
+{
+    ListingOptions options;
+    options.path = m_path;
+    options.nameFilters = m_nameFilters;
+    options.suffixes = m_suffixes;
+    options.showDirs = m_showDirs;
+    options.showFiles = m_showFiles;
+    options.batchSize = m_batchSize;
+    options.streaming = streaming;
+
+    // The promise is shared with the worker, so it stays valid even if the
+    // model is gone by the time the listing ends.
+    auto promise = std::make_shared<QPromise<QList<DirectoryEntry>>>();
+    promise->start();
+
+    m_listing = new QFutureWatcher<QList<DirectoryEntry>>(this);
+    if (streaming) {
+        connect(m_listing, &QFutureWatcherBase::resultsReadyAt, this, [this](int begin, int end) {
+            for (int i = begin; i < end; ++i)
+                insertBatch(m_listing->resultAt(i));
+        });
+    }
+    connect(m_listing, &QFutureWatcherBase::finished, this, &DirectoryModel::listingFinished);
+    m_listing->setFuture(promise->future());
+    m_listingStreaming = streaming;
+    if (streaming)
+        setLoading(true);
+
+    QThreadPool::globalInstance()->start([promise, options]() {
+        listDirectory(*promise, options);
+        promise->finish();
+    });
+}
+
+// Results a replaced listing already queued are dropped along with its watcher
+void DirectoryModel::stopListing()
+{
+    if (m_listing) {
+        m_listing->cancel();
+        disconnect(m_listing, nullptr, this, nullptr);
+        m_listing->deleteLater();
+        m_listing = nullptr;
+    }
+    setLoading(false);
+}
+
+void DirectoryModel::insertBatch(QList<DirectoryEntry> entries)
+{
+    std::sort(entries.begin(), entries.end(), entryLessThan);
+
+    // Entries landing between the same two rows go in with one insertion
+    int i = 0;
+    while (i < entries.size()) {
+        const int row = std::lower_bound(m_entries.cbegin(), m_entries.cend(), entries.at(i),
+                                         entryLessThan) - m_entries.cbegin();
+        int end = i + 1;
+        while (end < entries.size()
+               && (row == m_entries.size() || entryLessThan(entries.at(end), m_entries.at(row))))
+            ++end;
+
+        beginInsertRows(QModelIndex(), row, row + end - i - 1);
+        for (int j = i; j < end; ++j)
+            m_entries.insert(row + j - i, entries.at(j));
+        endInsertRows();
+        i = end;
+    }
+    emit countChanged();
+}
+
+void DirectoryModel::listingFinished()
+{
+    const bool streaming = m_listingStreaming;
+    QFutureWatcher<QList<DirectoryEntry>> *listing = m_listing;
+    m_listing = nullptr;
+    listing->deleteLater();
+    setLoading(false);
+
+    if (!streaming && listing->resultCount() > 0) {
+        QList<DirectoryEntry> sorted = listing->resultAt(0);
+        std::sort(sorted.begin(), sorted.end(), entryLessThan);
+        applyChanges(sorted);
+    }
+
+    if (m_refreshQueued) {
+        m_refreshQueued = false;
+        refresh();
+    }
+}
+
+// Walks the current rows and a fresh sorted listing side by side, so only the
+// rows that actually changed are touched.
+void DirectoryModel::applyChanges(const QList<DirectoryEntry> &entries)
+{
+    const int oldCount = m_entries.size();
+    int row = 0;
+    int j = 0;
+    while (row < m_entries.size() || j < entries.size()) {
+        if (j == entries.size() || (row < m_entries.size()
+                                    && entryLessThan(m_entries.at(row), entries.at(j)))) {
+            int end = row + 1;
+            while (end < m_entries.size()
+                   && (j == entries.size() || entryLessThan(m_entries.at(end), entries.at(j))))
+                ++end;
+            beginRemoveRows(QModelIndex(), row, end - 1);
+            m_entries.remove(row, end - row);
+            endRemoveRows();
+        } else if (row == m_entries.size() || entryLessThan(entries.at(j), m_entries.at(row))) {
+            int end = j + 1;
+            while (end < entries.size()
+                   && (row == m_entries.size() || entryLessThan(entries.at(end), m_entries.at(row))))
+                ++end;
+            beginInsertRows(QModelIndex(), row, row + end - j - 1);
+            for (int k = j; k < end; ++k)
+                m_entries.insert(row + k - j, entries.at(k));
+            endInsertRows();
+            row += end - j;
+            j = end;
+        } else {
+            DirectoryEntry &entry = m_entries[row];
+            const DirectoryEntry &fresh = entries.at(j);
+            if (entry.size != fresh.size || entry.modified != fresh.modified) {
+                entry.size = fresh.size;
+                entry.modified = fresh.modified;
+                const QModelIndex changed = index(row);
+                emit dataChanged(changed, changed, { FileSizeRole, FileModifiedRole });
+            }
+            ++row;
+            ++j;
+        }
+    }
+
+    if (m_entries.size() != oldCount)
+        emit countChanged();
+}
+
+void DirectoryModel::setLoading(bool loading)
+{
+    if (m_loading == loading)
+        return;
+    m_loading = loading;
+    emit loadingChanged();
+}
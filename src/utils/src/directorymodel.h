@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef DIRECTORYMODEL_H
+#define DIRECTORYMODEL_H
+
+#include <QAbstractListModel>
+#include <QDateTime>
+#include <QFileSystemWatcher>
+#include <QFutureWatcher>
+#include <QList>
+#include <QTimer>
+#include <QStringList>
+#include <QUrl>
+
+struct DirectoryEntry {
+    QString name;
+    qint64 size = 0;
+    QDateTime modified;
+    bool isDir = false;
+};
+
+/*
+ * Contents of a directory, sorted with directories first then by name.
+ *
+ * Listing happens on a worker thread and rows are inserted in batches while
+ * it runs, so the first ones show up right away even in large folders.
+ * nameFilters are wildcards matched against the file name and suffixes are
+ * case-insensitive extensions; directories are not filtered. Once listed, the
+ * folder is watched and later changes are applied as individual row
+ * insertions, removals and updates. qrc:/ folders are listed but, as they
+ * never change, not watched.
+ */
+class DirectoryModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(QUrl folder READ folder WRITE setFolder NOTIFY folderChanged)
+    Q_PROPERTY(QStringList nameFilters READ nameFilters WRITE setNameFilters NOTIFY nameFiltersChanged)
+    Q_PROPERTY(QStringList suffixes READ suffixes WRITE setSuffixes NOTIFY suffixesChanged)
+    Q_PROPERTY(bool showDirs READ showDirs WRITE setShowDirs NOTIFY showDirsChanged)
+    Q_PROPERTY(bool showFiles READ showFiles WRITE setShowFiles NOTIFY showFilesChanged)
+    Q_PROPERTY(int batchSize READ batchSize WRITE setBatchSize NOTIFY batchSizeChanged)
+    Q_PROPERTY(bool loading READ loading NOTIFY loadingChanged)
+    Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
+
+public:
+    enum Roles {
+        FileNameRole = Qt::UserRole + 1,
+        FilePathRole,
+        FileUrlRole,
+        FileBaseNameRole,
+        FileSuffixRole,
+        FileSizeRole,
+        FileModifiedRole,
+        FileIsDirRole
+    };
+    Q_ENUM(Roles)
+
+    explicit DirectoryModel(QObject *parent = nullptr);
+    ~DirectoryModel();
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    QUrl folder() const { return m_folder; }
+    void setFolder(const QUrl &folder);
+    QStringList nameFilters() const { return m_nameFilters; }
+    void setNameFilters(const QStringList &filters);
+    QStringList suffixes() const { return m_suffixes; }
+    void setSuffixes(const QStringList &suffixes);
+    bool showDirs() const { return m_showDirs; }
+    void setShowDirs(bool show);
+    bool showFiles() const { return m_showFiles; }
+    void setShowFiles(bool show);
+    int batchSize() const { return m_batchSize; }
+    void setBatchSize(int size);
+    bool loading() const { return m_loading; }
+
+    Q_INVOKABLE QString filePath(int row) const;
+
+signals:
+    void folderChanged();
+    void nameFiltersChanged();
+    void suffixesChanged();
+    void showDirsChanged();
+    void showFilesChanged();
+    void batchSizeChanged();
+    void loadingChanged();
+    void countChanged();
+
+private:
+    void reload();
+    void queueReload();
+    void startListing(bool streaming);
+    void stopListing();
+    void refresh();
+    void insertBatch(QList<DirectoryEntry> entries);
+    void listingFinished();
+    void applyChanges(const QList<DirectoryEntry> &entries);
+    void setLoading(bool loading);
+
+    QUrl m_folder;
+    QString m_path;
+    QStringList m_nameFilters;
+    QStringList m_suffixes;
+    bool m_showDirs = true;
+    bool m_showFiles = true;
+    int m_batchSize = 64;
+    bool m_loading = false;
+    bool m_reloadQueued = false;
+    // Set when the folder changed during a streaming listing
+    bool m_refreshQueued = false;
+    QList<DirectoryEntry> m_entries;
+    // One result per batch when streaming, a single one with everything
+    // otherwise
+    QFutureWatcher<QList<DirectoryEntry>> *m_listing = nullptr;
+    bool m_listingStreaming = false;
+    QFileSystemWatcher m_watcher;
+    QTimer m_refreshTimer;
+};
+
+#endif // DIRECTORYMODEL_H
@@ -17,12 +17,149 @@
 
 #include "fileinfo.h"
 #include <QFile>
-#include <QRegularExpression>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QStringEncoder>
+#include <QVarLengthArray>
+#include <sys/stat.h>
 
-bool FileInfo::exists(const QString fileName)
+static const QLatin1String FILE_SCHEME("file://");
+static const QLatin1String QRC_SCHEME("qrc:/");
+
+// Each watched directory costs an inotify watch
+static const int MAX_CACHED_DIRECTORIES = 32;
+static const int MAX_CACHED_NAMES_PER_DIRECTORY = 2048;
+
+// Local paths are encoded on the stack and stat()ed directly, only resources
+// need a QString.
+static bool fileExists(const QString &fileName)
+{
+    QStringView path(fileName);
+    if (path.startsWith(QRC_SCHEME))
+        return QFile::exists(QLatin1Char(':') + path.mid(QRC_SCHEME.size() - 1).toString());
+    if (path.startsWith(FILE_SCHEME))
+        path = path.mid(FILE_SCHEME.size());
+    if (path.startsWith(QLatin1Char(':')))
+        return QFile::exists(path.toString());
+
+    QStringEncoder encoder(QStringEncoder::System);
+    QVarLengthArray<char, 512> buffer(encoder.requiredSpace(path.size()) + 1);
+    char *end = encoder.appendToBuffer(buffer.data(), path);
+    *end = '\0';
+
+    struct stat st;
+    return ::stat(buffer.constData(), &st) == 0;
+}
+
+// The directory whose changes can alter the answer for fileName: its parent,
+// or the closest ancestor that exists when the parent is missing, since the
+// parent can only appear by changing that ancestor.
+static QString watchedDirectory(const QString &fileName)
 {
-    QString file = QString(fileName);
-    file.replace(QRegularExpression("^file:\\/\\/"), "");
-    file.replace(QRegularExpression("^qrc:\\/"), ":/");
-    return QFile::exists(file);
+    QString path = fileName;
+    if (path.startsWith(QRC_SCHEME))
+        return QString();
+    if (path.startsWith(FILE_SCHEME))
+        path.remove(0, FILE_SCHEME.size());
+
+    QFileInfo directory(QFileInfo(path).absolutePath());
+    while (!directory.isDir() && !directory.isRoot())
+        directory.setFile(directory.absolutePath());
+    return directory.absoluteFilePath();
+}
+
+bool FileInfo::exists(const QString &fileName)
+{
+    if (!m_watcher)
+        return fileExists(fileName);
+
+    auto cached = m_cache.constFind(fileName);
+    if (cached != m_cache.cend()) {
+        if (!cached->directory.isEmpty())
+            m_cachedByDirectory.find(cached->directory)->lastUse = ++m_useClock;
+        return cached->exists;
+    }
+
+    const bool result = fileExists(fileName);
+    const QString directory = watchedDirectory(fileName);
+    // Resources never change
+    if (directory.isEmpty()) {
+        m_cache.insert(fileName, { result, QString() });
+        return result;
+    }
+
+    // Anything else is only cached if it is watched
+    auto cachedDirectory = m_cachedByDirectory.find(directory);
+    if (cachedDirectory == m_cachedByDirectory.end()) {
+        if (!m_watcher->addPath(directory))
+            return result;
+        if (m_cachedByDirectory.size() >= MAX_CACHED_DIRECTORIES)
+            evictDirectory();
+        cachedDirectory = m_cachedByDirectory.insert(directory, CachedDirectory());
+    }
+    cachedDirectory->lastUse = ++m_useClock;
+    if (cachedDirectory->names.size() < MAX_CACHED_NAMES_PER_DIRECTORY) {
+        cachedDirectory->names.append(fileName);
+        m_cache.insert(fileName, { result, directory });
+    }
+    return result;
+}
+
+QList<bool> FileInfo::existsMany(const QStringList &fileNames)
+{
+    QList<bool> result;
+    result.reserve(fileNames.size());
+    for (const QString &fileName : fileNames)
+        result.append(exists(fileName));
+    return result;
+}
+
+void FileInfo::setCacheEnabled(bool enabled)
+{
+    if (cacheEnabled() == enabled)
+        return;
+
+    if (enabled) {
+        m_watcher = new QFileSystemWatcher(this);
+        connect(m_watcher, &QFileSystemWatcher::directoryChanged, this, &FileInfo::forgetDirectory);
+    } else {
+        delete m_watcher;
+        m_watcher = nullptr;
+        m_cache.clear();
+        m_cachedByDirectory.clear();
+    }
+    emit cacheEnabledChanged();
+}
+
+void FileInfo::forgetDirectory(const QString &directory)
+{
+    auto cachedDirectory = m_cachedByDirectory.find(directory);
+    if (cachedDirectory == m_cachedByDirectory.end())
+        return;
+    for (const QString &name : std::as_const(cachedDirectory->names))
+        m_cache.remove(name);
+    cachedDirectory->names.clear();
+
+    // A directory that went away is no longer watched, start over if it
+    // comes back.
+    if (!QFileInfo::exists(directory)) {
+        m_watcher->removePath(directory);
+        m_cachedByDirectory.erase(cachedDirectory);
+    }
+}
+
+void FileInfo::evictDirectory()
+{
+    auto oldest = m_cachedByDirectory.begin();
+    for (auto it = m_cachedByDirectory.begin(); it != m_cachedByDirectory.end(); ++it) {
+        if (it->lastUse < oldest->lastUse)
+            oldest = it;
+    }
+    if (oldest == m_cachedByDirectory.end())
+        return;
+
+    for (const QString &name : std::as_const(oldest->names))
+        m_cache.remove(name);
+    m_watcher->removePath(oldest.key());
+    m_cachedByDirectory.erase(oldest);
 }
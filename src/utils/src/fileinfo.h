@@ -19,13 +19,29 @@
 #define FILEINFO_H
 
 #include <QObject>
+#include <QHash>
 #include <QJSEngine>
 #include <QQmlEngine>
+#include <QStringList>
 
+class QFileSystemWatcher;
+
+/*
+ * exists() accepts plain paths, file:// and qrc:/ URLs. With cacheEnabled,
+ * answers are remembered per name and forgotten when inotify reports a change
+ * in the parent directory, so delegates asking again cost a hash lookup.
+ *
+ * The cache is meant for pickers listing a few flat directories: only parent
+ * directories are watched, so renaming or removing one of their ancestors is
+ * not noticed. Names whose parent is missing are cached against the closest
+ * existing ancestor instead. It is bounded, the least recently used directory
+ * is dropped once too many are watched.
+ */
 class FileInfo : public QObject
 {
     Q_OBJECT
     Q_DISABLE_COPY(FileInfo)
+    Q_PROPERTY(bool cacheEnabled READ cacheEnabled WRITE setCacheEnabled NOTIFY cacheEnabledChanged)
     FileInfo() {}
 public:
     static QObject *qmlInstance(QQmlEngine *engine, QJSEngine *scriptEngine)
@@ -35,7 +51,33 @@ public:
 
         return new FileInfo;
     }
-    Q_INVOKABLE bool exists(const QString fileName);
+    Q_INVOKABLE bool exists(const QString &fileName);
+    Q_INVOKABLE QList<bool> existsMany(const QStringList &fileNames);
+
+    bool cacheEnabled() const { return m_watcher != nullptr; }
+    void setCacheEnabled(bool enabled);
+
+signals:
+    void cacheEnabledChanged();
+
+private:
+    struct CachedName {
+        bool exists;
+        // Watched parent, empty for resources
+        QString directory;
+    };
+    struct CachedDirectory {
+        QStringList names;
+        quint64 lastUse = 0;
+    };
+
+    void forgetDirectory(const QString &directory);
+    void evictDirectory();
+
+    QFileSystemWatcher *m_watcher = nullptr;
+    QHash<QString, CachedName> m_cache;
+    QHash<QString, CachedDirectory> m_cachedByDirectory;
+    quint64 m_useClock = 0;
 };
 
 #endif // FILEINFO_H
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "machineconfig.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QSettings>
+
+static const char *CONFIG_FILE = "/etc/asteroid/machine.conf";
+
+MachineConfig *MachineConfig::instance()
+{
+    static MachineConfig *s_instance = [] {
+        auto *config = new MachineConfig;
+        if (QCoreApplication::instance())
+            config->moveToThread(QCoreApplication::instance()->thread());
+        return config;
+    }();
+    return s_instance;
+}
+
+MachineConfig::MachineConfig()
+{
+    // A child, so that moveToThread() in instance() takes it along
+    m_watcher = new QFileSystemWatcher(this);
+    connect(m_watcher, &QFileSystemWatcher::fileChanged, this, &MachineConfig::reload);
+    connect(m_watcher, &QFileSystemWatcher::directoryChanged, this, &MachineConfig::reload);
+    reload();
+}
+
+// Editors and package managers usually replace the file, which drops it from
+// the watcher, so also watch its directory and re-add the file when it shows up.
+void MachineConfig::watch()
+{
+    const QFileInfo file(CONFIG_FILE);
+    if (file.exists() && !m_watcher->files().contains(file.filePath()))
+        m_watcher->addPath(file.filePath());
+    if (file.dir().exists() && m_watcher->directories().isEmpty())
+        m_watcher->addPath(file.path());
+}
+
+void MachineConfig::reload()
+{
+    watch();
+
+    QSettings settings(CONFIG_FILE, QSettings::IniFormat);
+    QSettings::Status status(settings.status());
+    if (status == QSettings::FormatError ) {
+        qWarning("Configuration file \"%s\" is in wrong format", CONFIG_FILE);
+    } else if (status != QSettings::NoError) {
+        qWarning("Unable to open \"%s\" configuration file", CONFIG_FILE);
+    }
+
+    MachineConfigData data;
+    data.roundScreen = settings.value("Display/ROUND", data.roundScreen).toBool();
+    data.borderGestureWidth = settings.value("Display/BORDER_GESTURE_WIDTH", data.borderGestureWidth).toReal();
+    data.flatTireHeight = settings.value("Display/FLAT_TIRE", data.flatTireHeight).toInt();
+    data.needsBurnInProtection = settings.value("Display/NEEDS_BURN_IN_PROTECTION", data.needsBurnInProtection).toBool();
+    data.hasWlan = settings.value("Capabilities/HAS_WLAN", data.hasWlan).toBool();
+    data.hasSpeaker = settings.value("Capabilities/HAS_SPEAKER", data.hasSpeaker).toBool();
+    data.machineName = settings.value("Identity/MACHINE", data.machineName).toString();
+
+    if (data == m_data)
+        return;
+    m_data = data;
+    emit changed();
+}
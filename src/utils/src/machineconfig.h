@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef MACHINECONFIG_H
+#define MACHINECONFIG_H
+
+#include "asteroidqmlprivate_global.h"
+
+#include <QObject>
+#include <QString>
+
+class QFileSystemWatcher;
+
+struct MachineConfigData {
+    bool roundScreen = false;
+    qreal borderGestureWidth = 0.1;
+    int flatTireHeight = 0;
+    bool needsBurnInProtection = true;
+    bool hasWlan = false;
+    bool hasSpeaker = false;
+    QString machineName = QStringLiteral("unknown");
+
+    bool operator==(const MachineConfigData &other) const = default;
+};
+
+/*
+ * Process-wide view of /etc/asteroid/machine.conf.
+ *
+ * The file is parsed once into a MachineConfigData and only parsed again when
+ * it changes on disk, so readers get plain field loads. Lives in the private
+ * asteroidqmlprivate library, so the utils and controls plugins see the same
+ * instance. Must be used from the GUI thread.
+ */
+class ASTEROIDQMLPRIVATE_EXPORT MachineConfig : public QObject
+{
+    Q_OBJECT
+    Q_DISABLE_COPY(MachineConfig)
+public:
+    static MachineConfig *instance();
+    static const MachineConfigData &data() { return instance()->m_data; }
+
+signals:
+    void changed();
+
+private slots:
+    void reload();
+
+private:
+    MachineConfig();
+    void watch();
+
+    MachineConfigData m_data;
+    QFileSystemWatcher *m_watcher;
+};
+
+#endif // MACHINECONFIG_H
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "systemidentity.h"
+
+#include <QFile>
+#include <QTextStream>
+
+static const char *HOST_FILE = "/etc/hostname";
+static const char *OS_RELEASE_FILE = "/etc/os-release";
+
+// Initialized on first call; C++ guarantees this is thread-safe.
+const SystemIdentity &SystemIdentity::instance()
+{
+    static const SystemIdentity s_instance;
+    return s_instance;
+}
+
+SystemIdentity::SystemIdentity()
+{
+    QFile host(HOST_FILE);
+    if (host.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        QTextStream in(&host);
+        in.setEncoding(QStringConverter::Utf8);
+        m_hostname = in.readLine().trimmed();
+    }
+
+    QFile release(OS_RELEASE_FILE);
+    if (release.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        QTextStream in(&release);
+        in.setEncoding(QStringConverter::Utf8);
+        while (!in.atEnd()) {
+            const QString line = in.readLine().trimmed();
+            if (line.startsWith('#'))
+                continue;
+            const int eq = line.indexOf('=');
+            if (eq <= 0)
+                continue;
+            QString value = line.mid(eq + 1);
+            if (value.size() >= 2 && (value.startsWith('"') || value.startsWith('\''))
+                    && value.endsWith(value.at(0)))
+                value = value.mid(1, value.size() - 2);
+            m_osRelease.insert(line.left(eq), value);
+        }
+    }
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef SYSTEMIDENTITY_H
+#define SYSTEMIDENTITY_H
+
+#include "asteroidqmlprivate_global.h"
+
+#include <QHash>
+#include <QString>
+
+/*
+ * What the device says about itself in /etc/hostname and /etc/os-release.
+ *
+ * Both files are parsed once per process, on first use, and the result is
+ * immutable so it can be read from any thread. Lives in the private
+ * asteroidqmlprivate library, so that "once per process" holds when both the
+ * utils and settings plugins are loaded.
+ */
+class ASTEROIDQMLPRIVATE_EXPORT SystemIdentity
+{
+    Q_DISABLE_COPY(SystemIdentity)
+public:
+    static const SystemIdentity &instance();
+
+    const QString &hostname() const { return m_hostname; }
+    // Unquoted os-release field, e.g. "NAME" or "BUILD_ID"
+    QString osRelease(const QString &key) const { return m_osRelease.value(key); }
+
+private:
+    SystemIdentity();
+
+    QString m_hostname;
+    QHash<QString, QString> m_osRelease;
+};
+
+#endif // SYSTEMIDENTITY_H
@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "systemmonitor.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QThread>
+
+#include <climits>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static const char *POWER_SUPPLY_DIR = "/sys/class/power_supply";
+
+static int openFile(const QString &path)
+{
+    return ::open(QFile::encodeName(path).constData(), O_RDONLY | O_CLOEXEC);
+}
+
+// Re-reads a whole (small) file into buf, NUL terminated
+static bool readFile(int fd, char *buf, size_t size)
+{
+    if (fd < 0)
+        return false;
+    const ssize_t n = ::pread(fd, buf, size - 1, 0);
+    if (n <= 0)
+        return false;
+    buf[n] = '\0';
+    return true;
+}
+
+// Value in kB of a "Key:   1234 kB" line of /proc/meminfo
+static qint64 meminfoValue(const char *meminfo, const char *key)
+{
+    const char *line = strstr(meminfo, key);
+    return line ? strtoll(line + strlen(key), nullptr, 10) : 0;
+}
+
+SystemPoller *SystemPoller::instance()
+{
+    static SystemPoller *s_instance = [] {
+        auto *thread = new QThread;
+        thread->setObjectName("SystemPoller");
+        auto *poller = new SystemPoller;
+        poller->moveToThread(thread);
+        if (QCoreApplication::instance()) {
+            QObject::connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, thread, [thread]() {
+                thread->quit();
+                thread->wait();
+            });
+        }
+        thread->start(QThread::LowPriority);
+        return poller;
+    }();
+    return s_instance;
+}
+
+SystemPoller::SystemPoller()
+{
+    m_timer = new QTimer(this);
+    connect(m_timer, &QTimer::timeout, this, &SystemPoller::poll);
+}
+
+SystemPoller::~SystemPoller()
+{
+    for (int fd : { m_statFd, m_statmFd, m_meminfoFd, m_loadavgFd, m_batteryLevelFd, m_batteryCurrentFd }) {
+        if (fd >= 0)
+            ::close(fd);
+    }
+}
+
+void SystemPoller::setClient(const void *client, int interval)
+{
+    QMetaObject::invokeMethod(this, [this, client, interval]() {
+        m_clients.insert(client, interval);
+        updateTimer();
+    });
+}
+
+void SystemPoller::removeClient(const void *client)
+{
+    QMetaObject::invokeMethod(this, [this, client]() {
+        m_clients.remove(client);
+        updateTimer();
+    });
+}
+
+void SystemPoller::openFiles()
+{
+    if (m_statFd >= 0)
+        return;
+
+    m_statFd = openFile("/proc/self/stat");
+    m_statmFd = openFile("/proc/self/statm");
+    m_meminfoFd = openFile("/proc/meminfo");
+    m_loadavgFd = openFile("/proc/loadavg");
+
+    const QDir supplies(POWER_SUPPLY_DIR);
+    for (const QString &supply : supplies.entryList(QDir::Dirs | QDir::NoDotAndDotDot)) {
+        QFile type(supplies.filePath(supply + "/type"));
+        if (!type.open(QIODevice::ReadOnly) || type.readAll().trimmed() != "Battery")
+            continue;
+        m_batteryLevelFd = openFile(supplies.filePath(supply + "/capacity"));
+        m_batteryCurrentFd = openFile(supplies.filePath(supply + "/current_now"));
+        break;
+    }
+}
+
+void SystemPoller::updateTimer()
+{
+    if (m_clients.isEmpty()) {
+        m_timer->stop();
+        m_polling = false;
+        return;
+    }
+
+    int interval = INT_MAX;
+    for (int clientInterval : std::as_const(m_clients))
+        interval = qMin(interval, clientInterval);
+
+    openFiles();
+    if (!m_timer->isActive()) {
+        m_timer->start(interval);
+        m_polling = true;
+        poll();
+    } else if (m_timer->interval() != interval) {
+        m_timer->setInterval(interval);
+    }
+}
+
+void SystemPoller::poll()
+{
+    SystemSample sample;
+    sample.timestamp = QDateTime::currentMSecsSinceEpoch();
+    char buf[4096];
+
+    // Fields 14 and 15, utime and stime, counted after the parenthesized comm
+    if (readFile(m_statFd, buf, sizeof(buf))) {
+        const char *p = strrchr(buf, ')');
+        for (int field = 2; p && field < 14; ++field)
+            p = strchr(p + 1, ' ');
+        if (p) {
+            char *end;
+            const qint64 utime = strtoll(p + 1, &end, 10);
+            sample.cpuTicks = utime + strtoll(end, nullptr, 10);
+        }
+    }
+
+    if (readFile(m_statmFd, buf, sizeof(buf))) {
+        char *end;
+        strtoll(buf, &end, 10);
+        sample.rss = strtoll(end, nullptr, 10) * (sysconf(_SC_PAGESIZE) / 1024);
+    }
+
+    if (readFile(m_meminfoFd, buf, sizeof(buf))) {
+        sample.memoryTotal = meminfoValue(buf, "MemTotal:");
+        sample.memoryAvailable = meminfoValue(buf, "MemAvailable:");
+    }
+
+    if (readFile(m_loadavgFd, buf, sizeof(buf)))
+        sample.loadAverage = strtod(buf, nullptr);
+
+    if (readFile(m_batteryLevelFd, buf, sizeof(buf)))
+        sample.batteryLevel = strtol(buf, nullptr, 10);
+    if (readFile(m_batteryCurrentFd, buf, sizeof(buf)))
+        sample.batteryCurrent = strtoll(buf, nullptr, 10);
+
+    emit sampled(sample);
+}
+
+SystemMonitor::SystemMonitor(QObject *parent) : QObject(parent)
+{
+}
+
+SystemMonitor::~SystemMonitor()
+{
+    if (m_subscribed)
+        SystemPoller::instance()->removeClient(this);
+    disconnect(m_frameConnection);
+}
+
+void SystemMonitor::setActive(bool active)
+{
+    if (m_active == active)
+        return;
+    m_active = active;
+    updateSubscription();
+    emit activeChanged();
+}
+
+void SystemMonitor::setInterval(int interval)
+{
+    interval = qMax(interval, 100);
+    if (m_interval == interval)
+        return;
+    m_interval = interval;
+    if (m_subscribed)
+        SystemPoller::instance()->setClient(this, m_interval);
+    emit intervalChanged();
+}
+
+void SystemMonitor::setHistorySize(int size)
+{
+    size = qMax(size, 0);
+    if (m_historySize == size)
+        return;
+    m_historySize = size;
+    m_history.clear();
+    emit historySizeChanged();
+}
+
+void SystemMonitor::setWindow(QQuickWindow *window)
+{
+    if (m_window == window)
+        return;
+    disconnect(m_frameConnection);
+    m_window = window;
+    m_frames = 0;
+    m_frameRate = 0;
+    // frameSwapped is emitted on the render thread.
+    if (m_window) {
+        m_frameConnection = connect(m_window, &QQuickWindow::frameSwapped, this, [this]() {
+            m_frames.fetch_add(1, std::memory_order_relaxed);
+        }, Qt::DirectConnection);
+    }
+    emit windowChanged();
+}
+
+void SystemMonitor::connectNotify(const QMetaMethod &signal)
+{
+    if (signal == QMetaMethod::fromSignal(&SystemMonitor::updated))
+        scheduleSubscriptionUpdate();
+}
+
+void SystemMonitor::disconnectNotify(const QMetaMethod &signal)
+{
+    // Also called with an invalid method by disconnect-all.
+    if (!signal.isValid() || signal == QMetaMethod::fromSignal(&SystemMonitor::updated))
+        scheduleSubscriptionUpdate();
+}
+
+// QML bindings drop and take their connections while they are re-evaluated,
+// so the decision waits until that is over.
+void SystemMonitor::scheduleSubscriptionUpdate()
+{
+    if (m_subscriptionUpdateQueued)
+        return;
+    m_subscriptionUpdateQueued = true;
+    QMetaObject::invokeMethod(this, [this]() {
+        m_subscriptionUpdateQueued = false;
+        updateSubscription();
+    }, Qt::QueuedConnection);
+}
+
+// receivers() counts the QML bindings currently attached. isSignalConnected()
+// can't be used: it stays true once a binding has ever been connected.
+void SystemMonitor::updateSubscription()
+{
+    const bool subscribe = m_active && receivers(SIGNAL(updated())) > 0;
+    if (subscribe == m_subscribed)
+        return;
+    m_subscribed = subscribe;
+    // The next sample starts a new measurement window
+    m_sample.timestamp = 0;
+
+    SystemPoller *poller = SystemPoller::instance();
+    if (subscribe) {
+        connect(poller, &SystemPoller::sampled, this, &SystemMonitor::onSampled);
+        poller->setClient(this, m_interval);
+    } else {
+        disconnect(poller, &SystemPoller::sampled, this, &SystemMonitor::onSampled);
+        poller->removeClient(this);
+    }
+    emit pollingChanged();
+}
+
+void SystemMonitor::onSampled(const SystemSample &sample)
+{
+    // The poller runs at the fastest interval requested by any monitor.
+    const qint64 elapsed = sample.timestamp - m_sample.timestamp;
+    if (elapsed < m_interval * 9 / 10)
+        return;
+
+    // CPU time used since this monitor's previous sample, whatever the pace of
+    // the other monitors
+    const SystemSample previous = m_sample;
+    m_sample = sample;
+    if (previous.timestamp > 0) {
+        const qreal seconds = (sample.cpuTicks - previous.cpuTicks) / qreal(sysconf(_SC_CLK_TCK));
+        m_sample.cpuUsage = 100 * seconds * 1000 / elapsed;
+    }
+
+    if (m_window && previous.timestamp > 0)
+        m_frameRate = m_frames.exchange(0) * 1000.0 / elapsed;
+    else
+        m_frames = 0;
+
+    record("cpuUsage", m_sample.cpuUsage);
+    record("rss", m_sample.rss);
+    record("memoryTotal", m_sample.memoryTotal);
+    record("memoryAvailable", m_sample.memoryAvailable);
+    record("loadAverage", m_sample.loadAverage);
+    record("batteryLevel", m_sample.batteryLevel);
+    record("batteryCurrent", m_sample.batteryCurrent);
+    record("frameRate", m_frameRate);
+
+    emit updated();
+}
+
+void SystemMonitor::record(const char *metric, qreal value)
+{
+    if (m_historySize <= 0)
+        return;
+
+    History &history = m_history[QLatin1String(metric)];
+    if (history.values.size() < m_historySize) {
+        history.values.append(value);
+        return;
+    }
+    history.values[history.next] = value;
+    history.next = (history.next + 1) % m_historySize;
+}
+
+QList<qreal> SystemMonitor::history(const QString &metric) const
+{
+    const History history = m_history.value(metric);
+    if (history.next == 0)
+        return history.values;
+    return history.values.mid(history.next) + history.values.mid(0, history.next);
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef SYSTEMMONITOR_H
+#define SYSTEMMONITOR_H
+
+#include <QObject>
+#include <QHash>
+#include <QList>
+#include <QPointer>
+#include <QQuickWindow>
+#include <QTimer>
+#include <atomic>
+
+struct SystemSample {
+    qint64 timestamp = 0;       // ms since epoch
+    qint64 cpuTicks = 0;        // utime + stime of this process, clock ticks
+    qreal cpuUsage = 0;         // % of one core, filled in by each monitor
+    qint64 rss = 0;             // kB
+    qint64 memoryTotal = 0;     // kB
+    qint64 memoryAvailable = 0; // kB
+    qreal loadAverage = 0;      // 1 minute
+    int batteryLevel = -1;      // %
+    qint64 batteryCurrent = 0;  // uA, negative while discharging on most kernels
+};
+
+/*
+ * Shared poller behind SystemMonitor, living on its own thread.
+ *
+ * The /proc and battery files are opened once and re-read with pread() at the
+ * shortest interval requested by the running monitors. The timer stops when
+ * no monitor is running. CPU time is handed out raw, each monitor turns it
+ * into a usage over its own interval.
+ */
+class SystemPoller : public QObject
+{
+    Q_OBJECT
+public:
+    static SystemPoller *instance();
+
+    // Thread-safe, client is only used as a key
+    void setClient(const void *client, int interval);
+    void removeClient(const void *client);
+    // Thread-safe, whether the poll timer is running
+    bool isPolling() const { return m_polling; }
+
+signals:
+    void sampled(const SystemSample &sample);
+
+private:
+    SystemPoller();
+    ~SystemPoller();
+    void openFiles();
+    void updateTimer();
+    void poll();
+
+    QTimer *m_timer;
+    QHash<const void *, int> m_clients;
+    int m_statFd = -1;
+    int m_statmFd = -1;
+    int m_meminfoFd = -1;
+    int m_loadavgFd = -1;
+    int m_batteryLevelFd = -1;
+    int m_batteryCurrentFd = -1;
+    std::atomic<bool> m_polling { false };
+};
+
+/*
+ * Live resource usage of the current process and the device, for on-watch
+ * diagnostics: CPU, RSS, memory, load, battery and, given a window, frame rate.
+ *
+ * Samples come from a poller thread shared by all instances. An instance only
+ * polls while it is active and something is connected to updated(), e.g. a
+ * binding on one of its properties; polling tells whether it currently does.
+ * history() returns up to historySize past values of a metric, oldest first,
+ * for small graphs.
+ */
+class SystemMonitor : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool active READ active WRITE setActive NOTIFY activeChanged)
+    Q_PROPERTY(int interval READ interval WRITE setInterval NOTIFY intervalChanged)
+    Q_PROPERTY(int historySize READ historySize WRITE setHistorySize NOTIFY historySizeChanged)
+    Q_PROPERTY(QQuickWindow *window READ window WRITE setWindow NOTIFY windowChanged)
+    Q_PROPERTY(bool polling READ polling NOTIFY pollingChanged)
+    Q_PROPERTY(qreal cpuUsage READ cpuUsage NOTIFY updated)
+    Q_PROPERTY(qint64 rss READ rss NOTIFY updated)
+    Q_PROPERTY(qint64 memoryTotal READ memoryTotal NOTIFY updated)
+    Q_PROPERTY(qint64 memoryAvailable READ memoryAvailable NOTIFY updated)
+    Q_PROPERTY(qreal loadAverage READ loadAverage NOTIFY updated)
+    Q_PROPERTY(int batteryLevel READ batteryLevel NOTIFY updated)
+    Q_PROPERTY(qint64 batteryCurrent READ batteryCurrent NOTIFY updated)
+    Q_PROPERTY(qreal frameRate READ frameRate NOTIFY updated)
+
+public:
+    explicit SystemMonitor(QObject *parent = nullptr);
+    ~SystemMonitor();
+
+    bool active() const { return m_active; }
+    void setActive(bool active);
+    int interval() const { return m_interval; }
+    void setInterval(int interval);
+    int historySize() const { return m_historySize; }
+    void setHistorySize(int size);
+    QQuickWindow *window() const { return m_window; }
+    void setWindow(QQuickWindow *window);
+    bool polling() const { return m_subscribed; }
+
+    qreal cpuUsage() const { return m_sample.cpuUsage; }
+    qint64 rss() const { return m_sample.rss; }
+    qint64 memoryTotal() const { return m_sample.memoryTotal; }
+    qint64 memoryAvailable() const { return m_sample.memoryAvailable; }
+    qreal loadAverage() const { return m_sample.loadAverage; }
+    int batteryLevel() const { return m_sample.batteryLevel; }
+    qint64 batteryCurrent() const { return m_sample.batteryCurrent; }
+    qreal frameRate() const { return m_frameRate; }
+
+    // metric is the name of one of the sampled properties, e.g. "cpuUsage"
+    Q_INVOKABLE QList<qreal> history(const QString &metric) const;
+
+signals:
+    void activeChanged();
+    void intervalChanged();
+    void historySizeChanged();
+    void windowChanged();
+    void pollingChanged();
+    void updated();
+
+protected:
+    void connectNotify(const QMetaMethod &signal) override;
+    void disconnectNotify(const QMetaMethod &signal) override;
+
+private:
+    // Fixed capacity, overwrites the oldest value once full
+    struct History {
+        QList<qreal> values;
+        int next = 0;
+    };
+
+    void scheduleSubscriptionUpdate();
+    void updateSubscription();
+    void onSampled(const SystemSample &sample);
+    void record(const char *metric, qreal value);
+
+    bool m_active = true;
+    bool m_subscribed = false;
+    bool m_subscriptionUpdateQueued = false;
+    int m_interval = 1000;
+    int m_historySize = 60;
+    QPointer<QQuickWindow> m_window;
+    QMetaObject::Connection m_frameConnection;
+    // Incremented from the render thread
+    std::atomic<int> m_frames { 0 };
+    SystemSample m_sample;
+    qreal m_frameRate = 0;
+    QHash<QString, History> m_history;
+};
+
+#endif // SYSTEMMONITOR_H
@@ -17,9 +17,12 @@
 
 #include "utils_plugin.h"
 #include <QtQml>
+#include "bluetoothdevicemodel.h"
 #include "bluetoothstatus.h"
 #include "devicespecs.h"
 #include "fileinfo.h"
+#include "systemmonitor.h"
+#include "directorymodel.h"
 
 UtilsPlugin::UtilsPlugin(QObject *parent) : QQmlExtensionPlugin(parent)
 {
@@ -32,5 +35,8 @@ void UtilsPlugin::registerTypes(const char *uri)
     qmlRegisterSingletonType<DeviceSpecs>(uri, 1,0, "DeviceSpecs", &DeviceSpecs::qmlInstance);
     qmlRegisterSingletonType<FileInfo>(uri, 1, 0, "FileInfo", &FileInfo::qmlInstance);
     qmlRegisterType<BluetoothStatus>(uri, 1, 0, "BluetoothStatus");
+    qmlRegisterType<BluetoothDeviceModel>(uri, 1, 0, "BluetoothDeviceModel");
+    qmlRegisterType<SystemMonitor>(uri, 1, 0, "SystemMonitor");
+    qmlRegisterType<DirectoryModel>(uri, 1, 0, "DirectoryModel");
 }
 
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+/*
+ * Per-call latency of a settings toggle, the MCE set_config call behind
+ * DisplaySettings, against a mock MCE on a private dbus-daemon.
+ *
+ * Compares a QDBusInterface built for each call, as the settings backends used
+ * to do, with a cached DBusProxy. The first call is reported on its own since
+ * that is where QDBusInterface introspects the remote object.
+ *
+ * Usage: dbusproxybenchmark [iterations]
+ */
+
+#include "dbusproxy.h"
+#include "privatebus.h"
+
+#include <QCoreApplication>
+#include <QDBusConnection>
+#include <QDBusInterface>
+#include <QDBusObjectPath>
+#include <QDBusVariant>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QThread>
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+
+static const char *MCE_SERVICE      = "com.nokia.mce";
+static const char *MCE_REQUEST_PATH = "/com/nokia/mce/request";
+static const char *MCE_REQUEST_IF   = "com.nokia.mce.request";
+static const char *BRIGHTNESS_KEY   = "/system/osso/dsm/display/display_brightness";
+
+class MockMce : public QObject
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "com.nokia.mce.request")
+public slots:
+    bool set_config(const QDBusObjectPath &key, const QDBusVariant &value)
+    {
+        m_values.insert(key.path(), value.variant());
+        return true;
+    }
+
+private:
+    QHash<QString, QVariant> m_values;
+};
+
+static QVariantList toggleArguments(int i)
+{
+    return { QVariant::fromValue(QDBusObjectPath(BRIGHTNESS_KEY)),
+             QVariant::fromValue(QDBusVariant(i % 2 ? 100 : 50)) };
+}
+
+// Runs call iterations times and prints the first call and the rest in
+// microseconds.
+static void measure(const char *name, int iterations, const std::function<bool(int)> &call)
+{
+    QList<qint64> samples;
+    samples.reserve(iterations);
+    QElapsedTimer timer;
+    for (int i = 0; i < iterations; ++i) {
+        timer.start();
+        if (!call(i)) {
+            std::printf("%-24s call %d failed\n", name, i);
+            return;
+        }
+        samples.append(timer.nsecsElapsed());
+    }
+
+    const qint64 first = samples.takeFirst();
+    std::sort(samples.begin(), samples.end());
+    qint64 total = 0;
+    for (qint64 sample : std::as_const(samples))
+        total += sample;
+
+    std::printf("%-24s first %8.1f us  median %8.1f us  p95 %8.1f us  mean %8.1f us\n", name,
+                first / 1000.0, samples.at(samples.size() / 2) / 1000.0,
+                samples.at(samples.size() * 95 / 100) / 1000.0,
+                total / 1000.0 / samples.size());
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    const int iterations = qMax(argc > 1 ? QByteArray(argv[1]).toInt() : 1000, 2);
+
+    PrivateBus bus;
+    if (!bus.start())
+        return 1;
+
+    // The mock replies from its own thread so that blocking on a reply in
+    // main() cannot deadlock, including QDBusInterface's introspection.
+    QThread serviceThread;
+    serviceThread.start();
+    MockMce mce;
+    mce.moveToThread(&serviceThread);
+
+    QDBusConnection service = QDBusConnection::connectToBus(bus.address(), "service");
+    if (!service.registerService(MCE_SERVICE)
+            || !service.registerObject(MCE_REQUEST_PATH, &mce, QDBusConnection::ExportAllSlots)) {
+        std::printf("Cannot register the mock MCE: %s\n", qPrintable(service.lastError().message()));
+        return 1;
+    }
+
+    QDBusConnection client = QDBusConnection::connectToBus(bus.address(), "client");
+
+    measure("QDBusInterface per call", iterations, [&client](int i) {
+        QDBusInterface mceRequest(MCE_SERVICE, MCE_REQUEST_PATH, MCE_REQUEST_IF, client);
+        QDBusPendingCall call = mceRequest.asyncCallWithArgumentList("set_config", toggleArguments(i));
+        call.waitForFinished();
+        return !call.isError();
+    });
+
+    DBusProxy *proxy = DBusProxy::forBus(client, MCE_SERVICE, MCE_REQUEST_PATH, MCE_REQUEST_IF);
+    measure("DBusProxy", iterations, [proxy](int i) {
+        QDBusPendingCall call = proxy->asyncCall("set_config", toggleArguments(i));
+        call.waitForFinished();
+        return !call.isError();
+    });
+
+    service.unregisterObject(MCE_REQUEST_PATH);
+    serviceThread.quit();
+    serviceThread.wait();
+    return 0;
+}
+
+#include "dbusproxybenchmark.moc"
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "privatebus.h"
+
+#include <QDebug>
+
+PrivateBus::~PrivateBus()
+{
+    if (m_daemon.state() != QProcess::NotRunning) {
+        m_daemon.kill();
+        m_daemon.waitForFinished();
+    }
+}
+
+bool PrivateBus::start()
+{
+    m_daemon.start("dbus-daemon", { "--session", "--nofork", "--print-address" });
+    if (!m_daemon.waitForStarted()) {
+        qWarning() << "PrivateBus: cannot start dbus-daemon:" << m_daemon.errorString();
+        return false;
+    }
+
+    while (!m_daemon.canReadLine()) {
+        if (!m_daemon.waitForReadyRead(5000)) {
+            qWarning() << "PrivateBus: dbus-daemon did not print its address";
+            return false;
+        }
+    }
+    m_address = QString::fromLocal8Bit(m_daemon.readLine()).trimmed();
+    return !m_address.isEmpty();
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef PRIVATEBUS_H
+#define PRIVATEBUS_H
+
+#include <QProcess>
+#include <QString>
+
+/*
+ * dbus-daemon owned by the test, so that mock services can be registered
+ * without touching the system or session bus. The daemon is killed when the
+ * object is destroyed.
+ */
+class PrivateBus
+{
+public:
+    ~PrivateBus();
+
+    bool start();
+    QString address() const { return m_address; }
+
+private:
+    QProcess m_daemon;
+    QString m_address;
+};
+
+#endif // PRIVATEBUS_H
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+/*
+ * BluetoothStatus against a mock org.bluez on a private dbus-daemon, which
+ * stands in for the system bus. Checks that PropertiesChanged keeps the mirror
+ * up to date without resyncs, including after org.bluez restarts, and that
+ * objects which go away stop being listened to.
+ */
+
+#include "bluetoothbackend.h"
+#include "bluetoothstatus.h"
+#include "privatebus.h"
+
+#include <QDBusConnection>
+#include <QDBusMetaType>
+#include <QSignalSpy>
+#include <QTest>
+
+typedef QMap<QDBusObjectPath, InterfaceList> ManagedObjects;
+Q_DECLARE_METATYPE(ManagedObjects)
+
+static const char *ADAPTER_PATH = "/org/bluez/hci0";
+static const char *DEVICE_PATH  = "/org/bluez/hci0/dev_00_11_22_33_44_55";
+
+class MockBluez : public QObject
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.freedesktop.DBus.ObjectManager")
+public:
+    ManagedObjects objects;
+    int managedObjectsCalls = 0;
+
+public slots:
+    ManagedObjects GetManagedObjects()
+    {
+        ++managedObjectsCalls;
+        return objects;
+    }
+};
+
+class tst_BluetoothStatus : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void propertiesChangedWithoutResync();
+    void oneResyncPerRestart();
+    void removedObjectUnsubscribed();
+    void cleanupTestCase();
+
+private:
+    void sendConnected(bool connected);
+    void registerBluez();
+    void unregisterBluez();
+
+    PrivateBus m_bus;
+    QDBusConnection m_service { QString() };
+    MockBluez m_bluez;
+    BluetoothStatus *m_status = nullptr;
+};
+
+void tst_BluetoothStatus::initTestCase()
+{
+    QVERIFY(m_bus.start());
+    // Must happen before anything touches QDBusConnection::systemBus()
+    qputenv("DBUS_SYSTEM_BUS_ADDRESS", m_bus.address().toLocal8Bit());
+
+    qDBusRegisterMetaType<InterfaceList>();
+    qDBusRegisterMetaType<ManagedObjects>();
+
+    m_bluez.objects[QDBusObjectPath(ADAPTER_PATH)]["org.bluez.Adapter1"] = { { "Powered", true } };
+    m_bluez.objects[QDBusObjectPath(DEVICE_PATH)]["org.bluez.Device1"] = {
+        { "Address", "00:11:22:33:44:55" }, { "Connected", true } };
+
+    m_service = QDBusConnection::connectToBus(m_bus.address(), "bluez");
+    QVERIFY(m_service.registerObject("/", &m_bluez, QDBusConnection::ExportAllSlots));
+    registerBluez();
+
+    m_status = new BluetoothStatus(this);
+    QTRY_VERIFY(m_status->getConnected());
+    QVERIFY(m_status->getPowered());
+}
+
+void tst_BluetoothStatus::cleanupTestCase()
+{
+    m_service.unregisterObject("/");
+    QDBusConnection::disconnectFromBus("bluez");
+}
+
+void tst_BluetoothStatus::registerBluez()
+{
+    QVERIFY(m_service.registerService("org.bluez"));
+}
+
+void tst_BluetoothStatus::unregisterBluez()
+{
+    QVERIFY(m_service.unregisterService("org.bluez"));
+}
+
+void tst_BluetoothStatus::sendConnected(bool connected)
+{
+    QDBusMessage signal = QDBusMessage::createSignal(DEVICE_PATH, "org.freedesktop.DBus.Properties",
+                                                     "PropertiesChanged");
+    signal << QStringLiteral("org.bluez.Device1") << QVariantMap { { "Connected", connected } }
+           << QStringList();
+    QVERIFY(m_service.send(signal));
+}
+
+void tst_BluetoothStatus::propertiesChangedWithoutResync()
+{
+    QSignalSpy changed(m_status, &BluetoothStatus::connectedChanged);
+    const int fetches = m_bluez.managedObjectsCalls;
+
+    const int count = 10;
+    for (int i = 0; i < count; ++i)
+        sendConnected(i % 2);
+
+    QTRY_COMPARE(changed.count(), count);
+    QVERIFY(m_status->getConnected());
+    // Signals update the mirror directly, no resync
+    QTest::qWait(200);
+    QCOMPARE(m_bluez.managedObjectsCalls, fetches);
+}
+
+void tst_BluetoothStatus::oneResyncPerRestart()
+{
+    // Every restart re-runs serviceRegistered(), none may add a second match
+    for (int i = 0; i < 3; ++i) {
+        unregisterBluez();
+        QTRY_VERIFY(!m_status->getConnected());
+        const int fetches = m_bluez.managedObjectsCalls;
+        registerBluez();
+        QTRY_VERIFY(m_status->getConnected());
+        QTest::qWait(200);
+        QCOMPARE(m_bluez.managedObjectsCalls, fetches + 1);
+    }
+
+    QSignalSpy changed(m_status, &BluetoothStatus::connectedChanged);
+    sendConnected(false);
+    QTRY_COMPARE(changed.count(), 1);
+    QVERIFY(!m_status->getConnected());
+    sendConnected(true);
+    QTRY_COMPARE(changed.count(), 2);
+}
+
+void tst_BluetoothStatus::removedObjectUnsubscribed()
+{
+    QSignalSpy changed(m_status, &BluetoothStatus::connectedChanged);
+
+    m_bluez.objects.remove(QDBusObjectPath(DEVICE_PATH));
+    QDBusMessage signal = QDBusMessage::createSignal("/", "org.freedesktop.DBus.ObjectManager",
+                                                     "InterfacesRemoved");
+    signal << QVariant::fromValue(QDBusObjectPath(DEVICE_PATH))
+           << QStringList { "org.bluez.Device1" };
+    QVERIFY(m_service.send(signal));
+    QTRY_VERIFY(!m_status->getConnected());
+    QCOMPARE(changed.count(), 1);
+
+    // A subscription left behind would see a signal from an object missing
+    // from the mirror and resync
+    const int fetches = m_bluez.managedObjectsCalls;
+    sendConnected(true);
+    QTest::qWait(200);
+    QCOMPARE(m_bluez.managedObjectsCalls, fetches);
+    QVERIFY(!m_status->getConnected());
+}
+
+QTEST_GUILESS_MAIN(tst_BluetoothStatus)
+
+#include "tst_bluetoothstatus.moc"
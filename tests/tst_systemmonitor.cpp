@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Florent Revest <revestflo@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 2.1 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+/*
+ * SystemMonitor only keeps the shared poller running while a QML binding
+ * actually reads it, and reports CPU usage over its own interval.
+ */
+
+#include "systemmonitor.h"
+
+#include <QDateTime>
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QScopedPointer>
+#include <QSignalSpy>
+#include <QTest>
+
+#include <unistd.h>
+
+class tst_SystemMonitor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void stopsWhenBindingGoesAway();
+    void stopsWhenBindingIsDropped();
+    void cpuUsageOverOwnInterval();
+};
+
+void tst_SystemMonitor::initTestCase()
+{
+    qmlRegisterType<SystemMonitor>("org.asteroid.utils", 1, 0, "SystemMonitor");
+}
+
+// The reader is destroyed, which disconnects its binding
+void tst_SystemMonitor::stopsWhenBindingGoesAway()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData("import QtQml\n"
+                      "import org.asteroid.utils\n"
+                      "QtObject {\n"
+                      "    property SystemMonitor monitor: SystemMonitor { interval: 100 }\n"
+                      "    property QtObject reader: QtObject { property real rss: monitor.rss }\n"
+                      "}\n", QUrl());
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY2(root, qPrintable(component.errorString()));
+
+    auto *monitor = root->property("monitor").value<SystemMonitor *>();
+    QTRY_VERIFY(monitor->polling());
+    QTRY_VERIFY(SystemPoller::instance()->isPolling());
+
+    delete root->property("reader").value<QObject *>();
+    QTRY_VERIFY(!monitor->polling());
+    QTRY_VERIFY(!SystemPoller::instance()->isPolling());
+}
+
+// The binding is still there but stops reading the monitor
+void tst_SystemMonitor::stopsWhenBindingIsDropped()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData("import QtQml\n"
+                      "import org.asteroid.utils\n"
+                      "QtObject {\n"
+                      "    property bool bound: true\n"
+                      "    property SystemMonitor monitor: SystemMonitor { interval: 100 }\n"
+                      "    property real cpu: bound ? monitor.cpuUsage : -1\n"
+                      "}\n", QUrl());
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY2(root, qPrintable(component.errorString()));
+
+    auto *monitor = root->property("monitor").value<SystemMonitor *>();
+    QTRY_VERIFY(monitor->polling());
+    // Re-evaluations while bound must not drop the subscription
+    QSignalSpy updated(monitor, &SystemMonitor::updated);
+    QTRY_VERIFY(updated.count() >= 3);
+    QVERIFY(monitor->polling());
+
+    root->setProperty("bound", false);
+    QTRY_VERIFY(!monitor->polling());
+    QTRY_VERIFY(!SystemPoller::instance()->isPolling());
+
+    root->setProperty("bound", true);
+    QTRY_VERIFY(monitor->polling());
+}
+
+// A fast monitor must not shrink the window a slow one measures over. The
+// samples are made up, so the expected usages are exact whatever the load of
+// the machine running the test.
+void tst_SystemMonitor::cpuUsageOverOwnInterval()
+{
+    SystemMonitor fast;
+    fast.setInterval(100);
+    SystemMonitor slow;
+    slow.setInterval(1000);
+
+    QSignalSpy fastUpdated(&fast, &SystemMonitor::updated);
+    QSignalSpy slowUpdated(&slow, &SystemMonitor::updated);
+    QTRY_VERIFY(fast.polling() && slow.polling());
+
+    // Emitted from this thread, the samples are delivered right away and real
+    // ones queued by the poller can't slip in between. Timestamps are in the
+    // future so the first one is taken by both monitors.
+    const qint64 start = QDateTime::currentMSecsSinceEpoch() + 3600 * 1000;
+    const qint64 ticksPerSecond = sysconf(_SC_CLK_TCK);
+    fastUpdated.clear();
+    slowUpdated.clear();
+    // Busy for the first 600 ms of the slow monitor's window, idle after
+    for (int step = 0; step <= 10; ++step) {
+        SystemSample sample;
+        sample.timestamp = start + step * 100;
+        sample.cpuTicks = qMin(step, 6) * ticksPerSecond / 10;
+        emit SystemPoller::instance()->sampled(sample);
+    }
+
+    QCOMPARE(fastUpdated.count(), 11);
+    QCOMPARE(slowUpdated.count(), 2);
+    QCOMPARE(fast.cpuUsage(), 0.0);
+    QVERIFY2(qAbs(slow.cpuUsage() - 60) < 1, qPrintable(QString::number(slow.cpuUsage())));
+}
+
+QTEST_GUILESS_MAIN(tst_SystemMonitor)
+
+#include "tst_systemmonitor.moc"